@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+
+"""Deterministic replay benchmark built on the `simulate` verb.
+
+Every save listed in the saves file is simulated for a fixed number of
+ticks. The final scenario ticks and rng seeds must match the values expected
+by the saves file exactly, otherwise the run is reported as a desync. A save
+without expected values fails the run as well. Use --record-expected to
+write them into the saves file from the current build, then commit it.
+
+Ticks per second are compared against the baseline in the results file and
+a drop larger than the allowed tolerance fails the run. Baselines are
+specific to the machine and build that produced them, so they are kept in a
+separate results file (normally in the build directory). Use --record to
+(re)write it from the current build. Saves without a baseline are only
+checked for desyncs.
+
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+
+class ExitStatus:
+    SUCCESS = 0
+    FAILURE = 1
+    TROUBLE = 2
+
+
+SCENARIO_TICKS_RE = re.compile(r'scenario ticks:\s*(\d+)')
+RNG_RE = re.compile(r'rng:\s*\{\s*0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+)\s*\}')
+
+
+def run_simulate(openloco, save_path, ticks):
+    with tempfile.TemporaryDirectory() as tmp:
+        timings_path = os.path.join(tmp, 'timings.json')
+        proc = subprocess.run(
+            [openloco, 'simulate', save_path, str(ticks), '--timings_json', timings_path],
+            stdout=subprocess.PIPE,
+            stderr=subprocess.STDOUT,
+            universal_newlines=True)
+
+        output = proc.stdout
+        scenario_ticks = SCENARIO_TICKS_RE.search(output)
+        rng = RNG_RE.search(output)
+        if proc.returncode != 0 or scenario_ticks is None or rng is None or not os.path.exists(timings_path):
+            raise RuntimeError('simulate failed for {}:\n{}'.format(save_path, output))
+
+        with open(timings_path, 'r') as f:
+            timings = json.load(f)
+
+    return {
+        'scenarioTicks': int(scenario_ticks.group(1)),
+        'rng': ['0x' + rng.group(1).upper(), '0x' + rng.group(2).upper()],
+        'ticksPerSecond': timings['ticksPerSecond'],
+    }
+
+
+def write_json(path, data):
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, 'w') as f:
+        json.dump(data, f, indent=4)
+        f.write('\n')
+    print('written to {}'.format(path))
+
+
+def load_results(path):
+    if not os.path.exists(path):
+        return {}
+    with open(path, 'r') as f:
+        return json.load(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--openloco', required=True, help='path to the OpenLoco executable')
+    parser.add_argument('--saves', required=True, help='directory containing the reference saves')
+    parser.add_argument('--saves-list', required=True, help='JSON file describing the saves to simulate')
+    parser.add_argument('--results', required=True, help='JSON file holding the ticks per second recorded on this machine')
+    parser.add_argument('--tolerance', type=float, default=0.10,
+                        help='allowed ticks per second regression as a fraction (default: 0.10)')
+    parser.add_argument('--record', action='store_true',
+                        help='record the current ticks per second into the results file')
+    parser.add_argument('--record-expected', action='store_true',
+                        help='record the current scenario ticks and rng into the saves file')
+    args = parser.parse_args()
+
+    with open(args.saves_list, 'r') as f:
+        saves_list = json.load(f)
+    saves = saves_list['saves']
+    results = load_results(args.results)
+
+    status = ExitStatus.SUCCESS
+    for entry in saves:
+        save_path = os.path.join(args.saves, entry['path'])
+        if not os.path.exists(save_path):
+            print('{}: missing save {}'.format(entry['name'], save_path))
+            status = ExitStatus.TROUBLE
+            continue
+
+        try:
+            result = run_simulate(args.openloco, save_path, entry['ticks'])
+        except RuntimeError as e:
+            print('{}: {}'.format(entry['name'], e))
+            status = ExitStatus.TROUBLE
+            continue
+
+        if args.record_expected:
+            entry['scenarioTicks'] = result['scenarioTicks']
+            entry['rng'] = result['rng']
+            print('{}: recorded scenario ticks {}, rng {}'.format(entry['name'], result['scenarioTicks'], result['rng']))
+            continue
+
+        if entry.get('scenarioTicks') is None or entry.get('rng') is None:
+            print('{}: no expected scenario ticks and rng, run with --record-expected and commit the saves file'.format(
+                entry['name']))
+            status = ExitStatus.FAILURE
+            continue
+
+        desync = (result['scenarioTicks'] != entry['scenarioTicks']
+                  or [int(x, 16) for x in result['rng']] != [int(x, 16) for x in entry['rng']])
+        if desync:
+            print('{}: DESYNC expected scenario ticks {} rng {}, got scenario ticks {} rng {}'.format(
+                entry['name'], entry['scenarioTicks'], entry['rng'], result['scenarioTicks'], result['rng']))
+            status = ExitStatus.FAILURE
+            continue
+
+        if args.record:
+            results[entry['name']] = {'ticks': entry['ticks'], 'ticksPerSecond': result['ticksPerSecond']}
+            print('{}: recorded {:.1f} ticks/s'.format(entry['name'], result['ticksPerSecond']))
+            continue
+
+        baseline = results.get(entry['name'])
+        if baseline is None or baseline.get('ticks') != entry['ticks']:
+            # Not recorded on this machine, or the saves list changed since
+            print('{}: OK {:.1f} ticks/s (no baseline, run with --record)'.format(entry['name'], result['ticksPerSecond']))
+            continue
+
+        expected_tps = baseline['ticksPerSecond']
+        change = (result['ticksPerSecond'] - expected_tps) / expected_tps if expected_tps > 0 else 0.0
+        slow = change < -args.tolerance
+        print('{}: {} {:.1f} ticks/s (baseline {:.1f}, {:+.1f}%)'.format(
+            entry['name'], 'SLOW' if slow else 'OK', result['ticksPerSecond'], expected_tps, change * 100))
+        if slow:
+            status = ExitStatus.FAILURE
+
+    if status == ExitStatus.SUCCESS:
+        if args.record_expected:
+            write_json(args.saves_list, saves_list)
+        elif args.record:
+            write_json(args.results, results)
+    return status
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpenLoco::Core
+{
+    /**
+     * A fixed set of worker threads for splitting independent work items across cores.
+     * Work is submitted with parallelFor which blocks the calling thread until every
+     * item has been processed. The calling thread takes part in processing the items.
+     * A parallelFor started from inside a job of the same pool runs its items inline.
+     */
+    class ThreadPool
+    {
+    private:
+        using Job = std::function<void(size_t)>;
+
+        std::vector<std::thread> _workers;
+        std::mutex _submitMutex; // Only one parallelFor may run at a time
+        std::mutex _mutex;
+        std::condition_variable _workAvailable;
+        std::condition_variable _workFinished;
+
+        const Job* _job{};
+        size_t _jobCount{};
+        uint32_t _jobGeneration{};
+        std::atomic<size_t> _nextIndex{};
+        size_t _activeWorkers{};
+        std::exception_ptr _exception;
+        bool _stopping{};
+
+        void workerMain();
+        void runItems(const Job& job, size_t count);
+
+    public:
+        // numThreads is the total number of threads including the calling thread, 0 uses one per core
+        explicit ThreadPool(size_t numThreads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Pool with one thread per core shared by the game, created on first use
+        static ThreadPool& getShared();
+
+        // Total number of threads that process items, including the calling thread
+        size_t size() const;
+
+        // Calls job(i) for every i in [0, count). Items may run in any order and on any thread.
+        // If a job throws, the first exception is rethrown on the calling thread once all
+        // threads have stopped.
+        void parallelFor(size_t count, const Job& job);
+    };
+}
@@ -0,0 +1,153 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace OpenLoco::Core
+{
+    // Pool whose items the current thread is processing, used to detect nested parallelFor calls
+    static thread_local const ThreadPool* _runningPool = nullptr;
+
+    ThreadPool& ThreadPool::getShared()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    ThreadPool::ThreadPool(size_t numThreads)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        // The calling thread of parallelFor is also a worker
+        _workers.reserve(numThreads - 1);
+        for (size_t i = 1; i < numThreads; i++)
+        {
+            _workers.emplace_back([this] { workerMain(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::unique_lock<std::mutex> lk(_mutex);
+            _stopping = true;
+        }
+        _workAvailable.notify_all();
+        for (auto& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    size_t ThreadPool::size() const
+    {
+        return _workers.size() + 1;
+    }
+
+    void ThreadPool::runItems(const Job& job, size_t count)
+    {
+        const auto* previousPool = _runningPool;
+        _runningPool = this;
+        for (auto i = _nextIndex.fetch_add(1); i < count; i = _nextIndex.fetch_add(1))
+        {
+            try
+            {
+                job(i);
+            }
+            catch (...)
+            {
+                std::unique_lock<std::mutex> lk(_mutex);
+                if (_exception == nullptr)
+                {
+                    _exception = std::current_exception();
+                }
+                // Skip all remaining items
+                _nextIndex = count;
+            }
+        }
+        _runningPool = previousPool;
+    }
+
+    void ThreadPool::workerMain()
+    {
+        uint32_t lastGeneration = 0;
+        for (;;)
+        {
+            const Job* job = nullptr;
+            size_t count = 0;
+            {
+                std::unique_lock<std::mutex> lk(_mutex);
+                _workAvailable.wait(lk, [&] { return _stopping || _jobGeneration != lastGeneration; });
+                if (_stopping)
+                {
+                    return;
+                }
+                lastGeneration = _jobGeneration;
+                if (_job == nullptr)
+                {
+                    // Woke up after the job had already been completed
+                    continue;
+                }
+                job = _job;
+                count = _jobCount;
+                _activeWorkers++;
+            }
+
+            runItems(*job, count);
+
+            {
+                std::unique_lock<std::mutex> lk(_mutex);
+                _activeWorkers--;
+            }
+            _workFinished.notify_all();
+        }
+    }
+
+    void ThreadPool::parallelFor(size_t count, const Job& job)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Nested calls can not wait for the workers as they may be the ones running the outer job
+        if (_workers.empty() || count == 1 || _runningPool == this)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                job(i);
+            }
+            return;
+        }
+
+        std::unique_lock<std::mutex> submitLk(_submitMutex);
+        {
+            std::unique_lock<std::mutex> lk(_mutex);
+            _job = &job;
+            _jobCount = count;
+            _nextIndex = 0;
+            _exception = nullptr;
+            _jobGeneration++;
+        }
+        _workAvailable.notify_all();
+
+        runItems(job, count);
+
+        std::exception_ptr exception;
+        {
+            // Workers that have not picked up the job yet will find no items left, but they
+            // still hold a pointer to the job so we must wait for them all to finish
+            std::unique_lock<std::mutex> lk(_mutex);
+            _workFinished.wait(lk, [&] { return _activeWorkers == 0 && _nextIndex >= count; });
+            _job = nullptr;
+            exception = _exception;
+            _exception = nullptr;
+        }
+
+        if (exception != nullptr)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}
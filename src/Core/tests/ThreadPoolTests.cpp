@@ -0,0 +1,75 @@
+#include <OpenLoco/Core/ThreadPool.h>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace OpenLoco;
+
+TEST(ThreadPoolTests, processesEveryItemOnce)
+{
+    Core::ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+
+    for (size_t count : { 0, 1, 3, 1000 })
+    {
+        std::vector<std::atomic<int>> hits(count);
+        pool.parallelFor(count, [&](size_t i) { hits[i]++; });
+        for (auto& hit : hits)
+        {
+            EXPECT_EQ(hit, 1);
+        }
+    }
+}
+
+TEST(ThreadPoolTests, singleThread)
+{
+    Core::ThreadPool pool(1);
+    EXPECT_EQ(pool.size(), 1);
+
+    size_t sum = 0;
+    pool.parallelFor(100, [&](size_t i) { sum += i; });
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST(ThreadPoolTests, rethrowsException)
+{
+    Core::ThreadPool pool(4);
+    EXPECT_THROW(pool.parallelFor(100, [](size_t i) {
+        if (i == 50)
+        {
+            throw std::runtime_error("fail");
+        }
+    }),
+                 std::runtime_error);
+
+    // Pool must still be usable afterwards
+    std::atomic<size_t> count{};
+    pool.parallelFor(100, [&](size_t) { count++; });
+    EXPECT_EQ(count, 100);
+}
+
+TEST(ThreadPoolTests, nestedParallelForRunsInline)
+{
+    Core::ThreadPool pool(4);
+
+    std::vector<std::atomic<int>> hits(16 * 16);
+    pool.parallelFor(16, [&](size_t i) {
+        pool.parallelFor(16, [&](size_t j) { hits[i * 16 + j]++; });
+    });
+    for (auto& hit : hits)
+    {
+        EXPECT_EQ(hit, 1);
+    }
+}
+
+TEST(ThreadPoolTests, sharedPool)
+{
+    auto& pool = Core::ThreadPool::getShared();
+    EXPECT_EQ(&pool, &Core::ThreadPool::getShared());
+    EXPECT_GE(pool.size(), 1);
+
+    std::atomic<size_t> count{};
+    pool.parallelFor(100, [&](size_t) { count++; });
+    EXPECT_EQ(count, 100);
+}
@@ -0,0 +1,180 @@
+#include "Entities/EntitySpatialIndex.h"
+#include <OpenLoco/Engine/World.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Moves 10,000 entities across the map one tile at a time, unlinking them from the spatial
+// index by walking the tile list (as before) and through the previous entity links.
+// Half of the entities are packed into a small area like a busy rail yard.
+// Usage: EntitySpatialIndexBenchmark [steps]
+
+using namespace OpenLoco;
+using namespace OpenLoco::EntityManager;
+
+static constexpr size_t kNumEntities = 10000;
+static constexpr size_t kSpatialIndexSize = (World::kMapPitch * World::kMapPitch) + 1;
+static constexpr int32_t kYardSize = 16;
+
+// Same size as an entity so the lists are chased through scattered memory
+struct FakeEntity
+{
+    EntityId nextQuadrantId = EntityId::null;
+    uint8_t pad[0x80 - sizeof(EntityId)]{};
+};
+
+struct TileLists
+{
+    std::vector<EntityId> heads = std::vector<EntityId>(kSpatialIndexSize, EntityId::null);
+    std::vector<FakeEntity> entities = std::vector<FakeEntity>(kNumEntities);
+    std::vector<uint32_t> tiles = std::vector<uint32_t>(kNumEntities);
+
+    EntityId& getNext(EntityId id)
+    {
+        return entities[enumValue(id)].nextQuadrantId;
+    }
+};
+
+struct Move
+{
+    EntityId id;
+    uint32_t tile;
+};
+
+static uint32_t getTileIndex(int32_t x, int32_t y)
+{
+    return static_cast<uint32_t>(World::kMapPitch * x + y);
+}
+
+static uint32_t nextRandom(uint32_t& state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+// Every entity steps to a neighbouring tile, staying inside the yard or the map
+static std::vector<Move> generateMoves(size_t steps)
+{
+    std::vector<int32_t> x(kNumEntities), y(kNumEntities);
+    uint32_t random = 12345;
+    for (size_t i = 0; i < kNumEntities; i++)
+    {
+        const auto range = i % 2 == 0 ? kYardSize : World::kMapColumns;
+        x[i] = nextRandom(random) % range;
+        y[i] = nextRandom(random) % range;
+    }
+
+    std::vector<Move> moves;
+    moves.reserve(kNumEntities * (steps + 1));
+    for (size_t i = 0; i < kNumEntities; i++)
+    {
+        moves.push_back({ EntityId(i), getTileIndex(x[i], y[i]) });
+    }
+    for (size_t step = 0; step < steps; step++)
+    {
+        for (size_t i = 0; i < kNumEntities; i++)
+        {
+            const auto range = i % 2 == 0 ? kYardSize : World::kMapColumns;
+            const auto direction = nextRandom(random) % 4;
+            const int32_t dx = direction == 0 ? 1 : direction == 1 ? -1 : 0;
+            const int32_t dy = direction == 2 ? 1 : direction == 3 ? -1 : 0;
+            x[i] = std::clamp(x[i] + dx, 0, range - 1);
+            y[i] = std::clamp(y[i] + dy, 0, range - 1);
+            moves.push_back({ EntityId(i), getTileIndex(x[i], y[i]) });
+        }
+    }
+    return moves;
+}
+
+static bool removeByWalking(TileLists& lists, size_t index, EntityId id)
+{
+    auto* link = &lists.heads[index];
+    for (size_t count = 0; enumValue(*link) < kNumEntities && count < kNumEntities; count++)
+    {
+        if (*link == id)
+        {
+            *link = lists.getNext(id);
+            return true;
+        }
+        link = &lists.getNext(*link);
+    }
+    return false;
+}
+
+template<typename TRemove, typename TInsert>
+static double measureNsPerMove(TileLists& lists, const std::vector<Move>& moves, TRemove&& remove, TInsert&& insert)
+{
+    // The first kNumEntities moves place the entities
+    for (size_t i = 0; i < kNumEntities; i++)
+    {
+        insert(lists, moves[i].tile, moves[i].id);
+        lists.tiles[i] = moves[i].tile;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = kNumEntities; i < moves.size(); i++)
+    {
+        const auto& move = moves[i];
+        auto& tile = lists.tiles[enumValue(move.id)];
+        if (tile != move.tile)
+        {
+            if (!remove(lists, tile, move.id))
+            {
+                std::fprintf(stderr, "entity %u was not found on its tile\n", enumValue(move.id));
+                std::exit(1);
+            }
+            insert(lists, move.tile, move.id);
+            tile = move.tile;
+        }
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / static_cast<double>(moves.size() - kNumEntities);
+}
+
+int main(int argc, const char** argv)
+{
+    const size_t steps = argc >= 2 ? std::max(1, std::atoi(argv[1])) : 200;
+    const auto moves = generateMoves(steps);
+    std::printf("entities: %zu, steps: %zu\n", kNumEntities, steps);
+
+    TileLists walked;
+    const auto walkedNs = measureNsPerMove(
+        walked, moves,
+        [](TileLists& lists, size_t index, EntityId id) { return removeByWalking(lists, index, id); },
+        [](TileLists& lists, size_t index, EntityId id) {
+            lists.getNext(id) = lists.heads[index];
+            lists.heads[index] = id;
+        });
+
+    TileLists linked;
+    SpatialLinks links(kNumEntities);
+    auto getNext = [&linked](EntityId id) -> EntityId& { return linked.getNext(id); };
+    const auto linkedNs = measureNsPerMove(
+        linked, moves,
+        [&](TileLists& lists, size_t index, EntityId id) { return links.remove(lists.heads.data(), index, id, getNext); },
+        [&](TileLists& lists, size_t index, EntityId id) { links.insert(lists.heads.data(), index, id, getNext); });
+
+    // Both must leave every tile list in the same order
+    for (size_t i = 0; i < kSpatialIndexSize; i++)
+    {
+        auto a = walked.heads[i];
+        auto b = linked.heads[i];
+        while (a == b && a != EntityId::null)
+        {
+            a = walked.getNext(a);
+            b = linked.getNext(b);
+        }
+        if (a != b)
+        {
+            std::fprintf(stderr, "tile %zu lists differ\n", i);
+            return 1;
+        }
+    }
+
+    std::printf("%-8s %12s\n", "remove", "ns/move");
+    std::printf("%-8s %12.1f\n", "walk", walkedNs);
+    std::printf("%-8s %12.1f\n", "links", linkedNs);
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "S5/SawyerCodec.h"
+#include "S5/SawyerStream.h"
+#include <OpenLoco/Utility/Stream.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Measures the throughput of the sawyer encodings on the largest chunk of a real save
+// (the tile elements) for each supported SIMD level.
+// Usage: SawyerCodecBenchmark <save.sv5> [iterations]
+
+using namespace OpenLoco;
+
+static std::vector<uint8_t> readLargestChunk(const fs::path& path)
+{
+    FileStream stream(path, StreamMode::read);
+    SawyerStreamReader reader(stream);
+    std::vector<uint8_t> largest;
+    // The last 4 bytes of the file are the checksum
+    while (stream.getPosition() + 4 < stream.getLength())
+    {
+        auto chunk = reader.readChunk();
+        if (chunk.size() > largest.size())
+        {
+            largest.assign(chunk.begin(), chunk.end());
+        }
+    }
+    return largest;
+}
+
+template<typename TFunc>
+static double measureMBps(size_t bytes, int iterations, TFunc&& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        func();
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds > 0.0 ? (static_cast<double>(bytes) * iterations) / (1024.0 * 1024.0) / seconds : 0.0;
+}
+
+static const char* getEncodingName(SawyerEncoding encoding)
+{
+    switch (encoding)
+    {
+        case SawyerEncoding::runLengthSingle:
+            return "runLengthSingle";
+        case SawyerEncoding::runLengthMulti:
+            return "runLengthMulti";
+        case SawyerEncoding::rotate:
+            return "rotate";
+        default:
+            return "uncompressed";
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <save.sv5> [iterations]\n", argv[0]);
+        return 2;
+    }
+    const int iterations = argc >= 3 ? std::max(1, std::atoi(argv[2])) : 10;
+
+    std::vector<uint8_t> chunk;
+    try
+    {
+        chunk = readLargestChunk(fs::u8path(argv[1]));
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "Unable to read %s: %s\n", argv[1], e.what());
+        return 2;
+    }
+    std::printf("chunk size: %zu bytes, iterations: %d\n", chunk.size(), iterations);
+    std::printf("%-8s %-16s %12s %12s %10s\n", "simd", "codec", "encode MB/s", "decode MB/s", "ratio");
+
+    const auto supportedLevel = SawyerCodec::getSupportedSimdLevel();
+    for (auto level = SawyerCodec::SimdLevel::scalar; level <= supportedLevel; level = static_cast<SawyerCodec::SimdLevel>(static_cast<uint8_t>(level) + 1))
+    {
+        SawyerCodec::setSimdLevel(level);
+        const auto* levelName = SawyerCodec::getSimdLevelName(level);
+
+        for (auto encoding : { SawyerEncoding::runLengthSingle, SawyerEncoding::runLengthMulti, SawyerEncoding::rotate })
+        {
+            MemoryStream encoded;
+            const auto encodeMBps = measureMBps(chunk.size(), iterations, [&]() {
+                encoded.setPosition(0);
+                SawyerStreamWriter writer(encoded);
+                writer.writeChunk(encoding, chunk.data(), chunk.size());
+            });
+
+            bool roundTrips = true;
+            const auto decodeMBps = measureMBps(chunk.size(), iterations, [&]() {
+                encoded.setPosition(0);
+                SawyerStreamReader reader(encoded);
+                auto decoded = reader.readChunk();
+                roundTrips &= decoded.size() == chunk.size() && std::memcmp(decoded.data(), chunk.data(), chunk.size()) == 0;
+            });
+            if (!roundTrips)
+            {
+                std::fprintf(stderr, "%s %s did not decode to the original data\n", levelName, getEncodingName(encoding));
+                return 1;
+            }
+
+            const auto ratio = static_cast<double>(encoded.getPosition()) / chunk.size();
+            std::printf("%-8s %-16s %12.1f %12.1f %10.3f\n", levelName, getEncodingName(encoding), encodeMBps, decodeMBps, ratio);
+        }
+
+        uint32_t checksum = 0;
+        const auto checksumMBps = measureMBps(chunk.size(), iterations, [&]() {
+            checksum += SawyerCodec::sumBytes(chunk.data(), chunk.size());
+        });
+        std::printf("%-8s %-16s %12.1f %12s %10s  (0x%08X)\n", levelName, "checksum", checksumMBps, "-", "-", checksum);
+    }
+    return 0;
+}
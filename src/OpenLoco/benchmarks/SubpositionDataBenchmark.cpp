@@ -0,0 +1,101 @@
+#include "GameState.h"
+#include "Map/Track/SubpositionData.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Walks the movement steps of every track and road id/rotation pair, once through the
+// tables as they are served and once copying each table into a vector as the lookups
+// used to do.
+// Usage: SubpositionDataBenchmark [iterations]
+
+using namespace OpenLoco;
+using namespace OpenLoco::World::TrackData;
+
+namespace OpenLoco
+{
+    // Only the traffic handedness is read, the rest of the game is not needed
+    GameState& getGameState()
+    {
+        alignas(GameState) static std::byte gameState[sizeof(GameState)];
+        return *reinterpret_cast<GameState*>(gameState);
+    }
+}
+
+static constexpr uint16_t kNumTrackAndDirections = 44 * 8;
+static constexpr uint16_t kNumRoadAndDirections = 10 * 8;
+
+template<typename TLookup>
+static int64_t walkAll(TLookup&& lookup, size_t& numLookups)
+{
+    int64_t sum = 0;
+    const auto walk = [&](auto&& moveInfos) {
+        for (const auto& moveInfo : moveInfos)
+        {
+            sum += moveInfo.loc.x + moveInfo.loc.y + moveInfo.loc.z + moveInfo.yaw;
+        }
+        numLookups++;
+    };
+
+    for (uint16_t trackAndDirection = 0; trackAndDirection < kNumTrackAndDirections; trackAndDirection++)
+    {
+        walk(lookup(getTrackSubPositon(trackAndDirection)));
+    }
+    for (auto handedness : { false, true })
+    {
+        getGameState().trafficHandedness = handedness;
+        // Bit 7 selects the reversed table and bit 8 the lane
+        for (uint16_t lane = 0; lane < 2; lane++)
+        {
+            for (uint16_t reversed = 0; reversed < 2; reversed++)
+            {
+                for (uint16_t roadAndDirection = 0; roadAndDirection < kNumRoadAndDirections; roadAndDirection++)
+                {
+                    walk(lookup(getRoadSubPositon((lane << 8) | (reversed << 7) | roadAndDirection)));
+                }
+            }
+        }
+    }
+    return sum;
+}
+
+template<typename TLookup>
+static double measureNsPerLookup(int iterations, TLookup&& lookup, int64_t& sum)
+{
+    size_t numLookups = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        sum = walkAll(lookup, numLookups);
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / static_cast<double>(numLookups);
+}
+
+int main(int argc, const char** argv)
+{
+    const int iterations = argc >= 2 ? std::max(1, std::atoi(argv[1])) : 1000;
+
+    int64_t spanSum = 0;
+    const auto spanNs = measureNsPerLookup(
+        iterations, [](stdx::span<const MoveInfo> moveInfos) { return moveInfos; }, spanSum);
+
+    int64_t copySum = 0;
+    const auto copyNs = measureNsPerLookup(
+        iterations, [](stdx::span<const MoveInfo> moveInfos) { return std::vector<MoveInfo>(moveInfos.begin(), moveInfos.end()); }, copySum);
+
+    if (spanSum != copySum)
+    {
+        std::fprintf(stderr, "lookups differ\n");
+        return 1;
+    }
+
+    std::printf("iterations: %d\n", iterations);
+    std::printf("%-8s %12s\n", "lookup", "ns/lookup");
+    std::printf("%-8s %12.1f\n", "span", spanNs);
+    std::printf("%-8s %12.1f\n", "copy", copyNs);
+    return 0;
+}
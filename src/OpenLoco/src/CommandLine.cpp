@@ -3,6 +3,7 @@
 #include "OpenLoco.h"
 #include "S5/S5.h"
 #include "S5/SawyerStream.h"
+#include "TickProfiler.h"
 #include <iostream>
 #include <optional>
 #include <string_view>
@@ -327,7 +328,10 @@ namespace OpenLoco
                           .registerOption("--help", "-h")
                           .registerOption("--version")
                           .registerOption("--intro")
-                          .registerOption("--log_levels", 1);
+                          .registerOption("--log_levels", 1)
+                          .registerOption("--timings")
+                          .registerOption("--timings_json", 1)
+                          .registerOption("--landscape_seed", 1);
 
         if (!parser.parse())
         {
@@ -389,6 +393,10 @@ namespace OpenLoco
         else
             options.logLevels = "info, warning, error";
 
+        options.timings = parser.hasOption("--timings");
+        options.timingsPath = parser.getArg("--timings_json");
+        options.landscapeSeed = parser.getArg<int32_t>("--landscape_seed");
+
         return options;
     }
 
@@ -429,6 +437,10 @@ namespace OpenLoco
         std::cout << "                  - info, warning, error, verbose, all" << std::endl;
         std::cout << "                  Example: --log_levels \"all, -verbose\", logs all but verbose levels" << std::endl;
         std::cout << "                  Default: \"info, warning, error\"" << std::endl;
+        std::cout << "--timings         Print per stage tick timings after simulate" << std::endl;
+        std::cout << "--timings_json    Write per stage tick timings after simulate as JSON to a path" << std::endl;
+        std::cout << "--landscape_seed  Seed for landscapes from the improved generator when the editor" << std::endl;
+        std::cout << "                  has none set, the same seed always creates the same landscape" << std::endl;
     }
 
     std::optional<int> runCommandLineOnlyCommand(const CommandLineOptions& options)
@@ -543,14 +555,22 @@ namespace OpenLoco
 
         auto inPath = fs::u8path(options.path);
         auto outPath = fs::u8path(options.outputPath);
+        auto timingsPath = fs::u8path(options.timingsPath);
+
+        TickProfiler::setEnabled(options.timings || !timingsPath.empty());
 
+        bool simulated = false;
         try
         {
-            OpenLoco::simulateGame(inPath, *options.ticks);
+            simulated = OpenLoco::simulateGame(inPath, *options.ticks);
         }
         catch (...)
+        {
+        }
+        if (!simulated)
         {
             std::fprintf(stderr, "Unable to load and simulate %s\n", inPath.u8string().c_str());
+            return 2;
         }
 
         auto& gameState = getGameState();
@@ -577,6 +597,24 @@ namespace OpenLoco
             }
         }
 
+        if (!timingsPath.empty())
+        {
+            try
+            {
+                TickProfiler::writeReport(timingsPath);
+                std::printf("  timings path:   %s\n", timingsPath.u8string().c_str());
+            }
+            catch (...)
+            {
+                std::fprintf(stderr, "Unable to write timings to %s\n", timingsPath.u8string().c_str());
+            }
+        }
+
+        if (options.timings)
+        {
+            TickProfiler::printReport();
+        }
+
         return 0;
     }
 }
@@ -27,6 +27,9 @@ namespace OpenLoco
         std::string bind;
         std::optional<uint16_t> port{};
         std::string logLevels;
+        bool timings{};
+        std::string timingsPath;
+        std::optional<int32_t> landscapeSeed;
     };
 
     std::optional<CommandLineOptions> parseCommandLine(int argc, const char** argv);
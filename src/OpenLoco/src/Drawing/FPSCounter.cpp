@@ -3,6 +3,7 @@
 #include "Graphics/Colour.h"
 #include "Graphics/Gfx.h"
 #include "Localisation/Formatting.h"
+#include "Paint/Paint.h"
 #include "Ui.h"
 
 #include <chrono>
@@ -60,5 +61,17 @@ namespace OpenLoco::Drawing
 
         // Make area dirty so the text doesn't get drawn over the last
         Gfx::invalidateRegion(x - 16, y - 4, x + 16, 16);
+
+#ifndef NDEBUG
+        // Paint struct usage, used to size the paint arena
+        const auto& paintStats = Paint::getPaintArenaStats();
+        snprintf(&buffer[3], std::size(buffer) - 3, "paint %u/%u, %u overflows", paintStats.peakEntries, paintStats.capacity, paintStats.overflows);
+
+        const int statsWidth = drawingCtx.getStringWidth(buffer);
+        const auto statsX = Ui::width() / 2 - (statsWidth / 2);
+        const auto statsY = y + 12;
+        drawingCtx.drawString(rt, statsX, statsY, Colour::black, buffer);
+        Gfx::invalidateRegion(statsX - 16, statsY - 4, statsX + statsWidth + 16, statsY + 16);
+#endif
     }
 }
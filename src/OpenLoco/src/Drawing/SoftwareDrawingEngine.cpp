@@ -1,5 +1,6 @@
 #include "SoftwareDrawingEngine.h"
 #include "Config.h"
+#include "Intro.h"
 #include "Logging.h"
 #include "Ui.h"
 #include "Ui/WindowManager.h"
@@ -80,6 +81,20 @@ namespace OpenLoco::Drawing
             }
             return dy;
         }
+
+        // Returns true if the dirty blocks of column x form exactly one run from y to y + dY
+        bool isExactRun(size_t x, size_t y, size_t dY)
+        {
+            if (y > 0 && (*this)[y - 1][x] != 0)
+            {
+                return false;
+            }
+            if (y + dY < this->m && (*this)[y + dY][x] != 0)
+            {
+                return false;
+            }
+            return getRows(x, 1, y) == dY;
+        }
     };
 
     void SoftwareDrawingEngine::resize(int32_t width, int32_t height)
@@ -113,11 +128,20 @@ namespace OpenLoco::Drawing
         int32_t pitch = _screenSurface->pitch;
 
         auto& rt = Gfx::getScreenRT();
-        if (rt.bits != nullptr)
+        if (_ownsScreenBits)
         {
             delete[] rt.bits;
         }
-        rt.bits = new uint8_t[_screenSurface->pitch * height];
+        // Draw straight into the surface so that present does not need to copy the screen
+        _ownsScreenBits = SDL_MUSTLOCK(_screenSurface);
+        if (_ownsScreenBits)
+        {
+            rt.bits = new uint8_t[_screenSurface->pitch * height];
+        }
+        else
+        {
+            rt.bits = static_cast<uint8_t*>(_screenSurface->pixels);
+        }
         rt.width = width;
         rt.height = height;
         rt.pitch = pitch - width;
@@ -136,6 +160,8 @@ namespace OpenLoco::Drawing
         _screenInvalidation->columnShift = widthShift;
         _screenInvalidation->rowShift = heightShift;
         _screenInvalidation->initialised = 1;
+
+        _presentAll = true;
     }
 
     /**
@@ -192,6 +218,31 @@ namespace OpenLoco::Drawing
         _setPaletteCallback = updatePaletteStatic;
     }
 
+    // Viewports are painted in columns 32 wide in view coordinates, and a rectangle cuts the columns
+    // at its edges. Merging two rectangles only paints the same as rendering them on their own if
+    // the edge between them is also the edge of a column in every viewport it crosses.
+    static bool isViewportColumnEdge(int16_t screenX)
+    {
+        for (size_t i = 0; i < WindowManager::count(); i++)
+        {
+            auto* w = WindowManager::get(i);
+            for (auto* viewport : w->viewports)
+            {
+                if (viewport == nullptr || screenX <= viewport->x || screenX >= viewport->x + viewport->width)
+                {
+                    continue;
+                }
+                const uint32_t bitmask = 0xFFFFFFFF << viewport->zoom;
+                const auto viewX = viewport->screenToViewport(Point(screenX, viewport->y)).x & bitmask;
+                if ((viewX & 0x1F) != 0)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
     // 0x004C5CFA
     void SoftwareDrawingEngine::render()
     {
@@ -206,11 +257,19 @@ namespace OpenLoco::Drawing
                 if (grid[y][x] == 0)
                     continue;
 
-                // Don't determine columns will cause rendering z fighting issues
-                const size_t dX = 1;
-
                 // Check rows
-                size_t dY = grid.getRows(x, dX, y);
+                const size_t dY = grid.getRows(x, 1, y);
+
+                // Merging columns with different dirty rows causes rendering z fighting issues as the
+                // viewport columns then get painted with different heights. Only merge neighbouring
+                // columns that have exactly the same run of dirty rows, and only across viewport column
+                // edges, so every part of the rectangle is painted as it would be on its own.
+                size_t dX = 1;
+                while (x + dX < columns && grid.isExactRun(x + dX, y, dY)
+                       && isViewportColumnEdge(static_cast<int16_t>((x + dX) * _screenInvalidation->blockWidth)))
+                {
+                    dX++;
+                }
 
                 render(x, y, dX, dY);
             }
@@ -254,14 +313,31 @@ namespace OpenLoco::Drawing
             basePtr->g = entryPtr->g;
             basePtr->b = entryPtr->b;
             basePtr->a = 0;
+
+            // Palette cycling sets the same ranges over and over, only pixels of colours that
+            // really changed have to be converted again
+            auto& current = _paletteEntries[index + i];
+            if (current.r != entryPtr->r || current.g != entryPtr->g || current.b != entryPtr->b)
+            {
+                current = *entryPtr;
+                _paletteChanged[index + i] = true;
+                _anyPaletteChanged = true;
+            }
         }
         SDL_SetPaletteColors(_palette, &base[index], index, count);
     }
 
+    void SoftwareDrawingEngine::invalidatePresent(const Rect& _rect)
+    {
+        auto max = Rect(0, 0, Ui::width(), Ui::height());
+        _presentRects.push_back(_rect.intersection(max));
+    }
+
     void SoftwareDrawingEngine::render(const Rect& _rect)
     {
         auto max = Rect(0, 0, Ui::width(), Ui::height());
         auto rect = _rect.intersection(max);
+        _presentRects.push_back(rect);
 
         registers regs;
         regs.ax = rect.left();
@@ -285,34 +361,137 @@ namespace OpenLoco::Drawing
         Ui::WindowManager::render(rt, rect);
     }
 
-    void SoftwareDrawingEngine::present()
+    bool SoftwareDrawingEngine::canConvertToSurface(const SDL_Surface* surface) const
     {
-        // Lock the surface before setting its pixels
-        if (SDL_MUSTLOCK(_screenSurface))
+        return !_ownsScreenBits && surface->format->BytesPerPixel == 4;
+    }
+
+    // Converts the 8 bit screen to a 32 bit surface. Only the regions rendered since the last
+    // present and the pixels of changed palette colours are converted unless the whole surface is
+    // out of date. Returns false if the surface could not be locked, nothing is converted then.
+    bool SoftwareDrawingEngine::convertToSurface(SDL_Surface* surface)
+    {
+        if (SDL_MUSTLOCK(surface))
         {
-            if (SDL_LockSurface(_screenSurface) < 0)
+            if (SDL_LockSurface(surface) < 0)
             {
-                return;
+                return false;
             }
         }
 
-        // Copy pixels from the virtual screen buffer to the surface
-        auto& rt = Gfx::getScreenRT();
-        if (rt.bits != nullptr)
+        if (_paletteLookupFormat != surface->format)
         {
-            std::memcpy(_screenSurface->pixels, rt.bits, _screenSurface->pitch * _screenSurface->h);
+            for (size_t i = 0; i < _paletteEntries.size(); i++)
+            {
+                const auto& entry = _paletteEntries[i];
+                _paletteLookup[i] = SDL_MapRGB(surface->format, entry.r, entry.g, entry.b);
+            }
+            _paletteLookupFormat = surface->format;
+            _presentAll = true;
+        }
+        else if (_anyPaletteChanged)
+        {
+            for (size_t i = 0; i < _paletteEntries.size(); i++)
+            {
+                if (_paletteChanged[i])
+                {
+                    const auto& entry = _paletteEntries[i];
+                    _paletteLookup[i] = SDL_MapRGB(surface->format, entry.r, entry.g, entry.b);
+                }
+            }
+        }
+
+        if (surface != _lastPresentSurface)
+        {
+            // Also happens when the window surface is recreated
+            _lastPresentSurface = surface;
+            _presentAll = true;
+        }
+
+        // The intro draws straight to the screen without invalidating anything
+        const bool convertAll = _presentAll || Intro::isActive();
+        if (convertAll)
+        {
+            _presentRects.clear();
+            _presentRects.push_back(Rect(0, 0, _screenSurface->w, _screenSurface->h));
+        }
+
+        const auto bounds = Rect(0, 0, std::min(_screenSurface->w, surface->w), std::min(_screenSurface->h, surface->h));
+        const auto* srcPixels = static_cast<const uint8_t*>(_screenSurface->pixels);
+        auto* dstPixels = static_cast<uint8_t*>(surface->pixels);
+
+        // The screen does not record where each colour is used, so this still reads every pixel
+        // but only writes the ones whose colour changed
+        if (_anyPaletteChanged && !convertAll)
+        {
+            for (auto y = bounds.top(); y < bounds.bottom(); y++)
+            {
+                const auto* src = srcPixels + y * _screenSurface->pitch;
+                auto* dst = reinterpret_cast<uint32_t*>(dstPixels + y * surface->pitch);
+                for (auto x = 0; x < bounds.width(); x++)
+                {
+                    if (_paletteChanged[src[x]])
+                    {
+                        dst[x] = _paletteLookup[src[x]];
+                    }
+                }
+            }
+        }
+        _paletteChanged.fill(false);
+        _anyPaletteChanged = false;
+
+        for (const auto& presentRect : _presentRects)
+        {
+            const auto rect = presentRect.intersection(bounds);
+            for (auto y = rect.top(); y < rect.bottom(); y++)
+            {
+                const auto* src = srcPixels + y * _screenSurface->pitch + rect.left();
+                auto* dst = reinterpret_cast<uint32_t*>(dstPixels + y * surface->pitch) + rect.left();
+                for (auto x = 0; x < rect.width(); x++)
+                {
+                    dst[x] = _paletteLookup[src[x]];
+                }
+            }
+        }
+
+        if (SDL_MUSTLOCK(surface))
+        {
+            SDL_UnlockSurface(surface);
         }
+        return true;
+    }
 
-        // Unlock the surface
-        if (SDL_MUSTLOCK(_screenSurface))
+    void SoftwareDrawingEngine::present()
+    {
+        if (_ownsScreenBits)
         {
+            // Lock the surface before setting its pixels
+            if (SDL_LockSurface(_screenSurface) < 0)
+            {
+                return;
+            }
+
+            // Copy pixels from the virtual screen buffer to the surface
+            auto& rt = Gfx::getScreenRT();
+            std::memcpy(_screenSurface->pixels, rt.bits, _screenSurface->pitch * _screenSurface->h);
+
             SDL_UnlockSurface(_screenSurface);
         }
 
+        // If the target can not be locked the frame is skipped, the regions to convert are kept
+        // for the next present
         auto scaleFactor = Config::get().scaleFactor;
         if (scaleFactor == 1 || scaleFactor <= 0)
         {
-            if (SDL_BlitSurface(_screenSurface, nullptr, SDL_GetWindowSurface(_window), nullptr))
+            auto* windowSurface = SDL_GetWindowSurface(_window);
+            if (canConvertToSurface(windowSurface))
+            {
+                if (!convertToSurface(windowSurface))
+                {
+                    return;
+                }
+            }
+            else if (SDL_BlitSurface(_screenSurface, nullptr, windowSurface, nullptr))
             {
                 Logging::error("SDL_BlitSurface {}", SDL_GetError());
                 exit(1);
@@ -320,8 +499,15 @@ namespace OpenLoco::Drawing
         }
         else
         {
-            // first blit to rgba surface to change the pixel format
-            if (SDL_BlitSurface(_screenSurface, nullptr, _screenRGBASurface, nullptr))
+            // first convert to the rgba surface to change the pixel format
+            if (canConvertToSurface(_screenRGBASurface))
+            {
+                if (!convertToSurface(_screenRGBASurface))
+                {
+                    return;
+                }
+            }
+            else if (SDL_BlitSurface(_screenSurface, nullptr, _screenRGBASurface, nullptr))
             {
                 Logging::error("SDL_BlitSurface {}", SDL_GetError());
                 exit(1);
@@ -335,6 +521,9 @@ namespace OpenLoco::Drawing
             }
         }
 
+        _presentRects.clear();
+        _presentAll = false;
+
         SDL_UpdateWindowSurface(_window);
     }
 
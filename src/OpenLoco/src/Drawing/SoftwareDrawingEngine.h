@@ -4,7 +4,9 @@
 #include "SoftwareDrawingContext.h"
 #include <OpenLoco/Engine/Ui/Rect.hpp>
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <vector>
 
 struct SDL_Palette;
 struct SDL_Surface;
@@ -40,6 +42,9 @@ namespace OpenLoco::Drawing
         // Presents the final image to the screen.
         void present();
 
+        // Marks pixels that were changed without rendering, such as those moved by scrolling a viewport.
+        void invalidatePresent(const Ui::Rect& rect);
+
         // Invalidates a region, this forces it to be rendered next frame.
         void invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom);
 
@@ -51,11 +56,28 @@ namespace OpenLoco::Drawing
 
     private:
         void render(size_t x, size_t y, size_t dx, size_t dy);
+        bool canConvertToSurface(const SDL_Surface* surface) const;
+        bool convertToSurface(SDL_Surface* surface);
 
         SDL_Window* _window{};
         SDL_Palette* _palette{};
         SDL_Surface* _screenSurface{};
         SDL_Surface* _screenRGBASurface{};
         SoftwareDrawingContext _ctx;
+
+        // The screen render target draws straight into the pixels of _screenSurface unless the
+        // surface has to be locked, in which case it has its own buffer that is copied on present.
+        bool _ownsScreenBits{};
+
+        // Regions rendered since the last present, only these need to be converted to 32 bit
+        std::vector<Ui::Rect> _presentRects;
+        bool _presentAll = true;
+        SDL_Surface* _lastPresentSurface{};
+        std::array<PaletteEntry, 256> _paletteEntries{};
+        // Colours changed since the last conversion, their pixels have to be converted again
+        std::array<bool, 256> _paletteChanged{};
+        bool _anyPaletteChanged{};
+        std::array<uint32_t, 256> _paletteLookup{};
+        const void* _paletteLookupFormat{};
     };
 }
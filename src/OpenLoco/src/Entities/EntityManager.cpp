@@ -1,4 +1,5 @@
 #include "EntityManager.h"
+#include "EntitySpatialIndex.h"
 #include "EntityTweener.h"
 #include "GameCommands/GameCommands.h"
 #include "GameState.h"
@@ -20,7 +21,8 @@ namespace OpenLoco::EntityManager
     static_assert(kEntitySpatialIndexNull == 0x40000);
 
     loco_global<EntityId[kSpatialEntityMapSize], 0x01025A8C> _entitySpatialIndex;
-    loco_global<uint32_t, 0x01025A88> _entitySpatialCount;
+
+    static SpatialLinks _spatialLinks(Limits::kMaxEntities);
 
     static auto& rawEntities() { return getGameState().entities; }
     static auto entities() { return FixedVector(rawEntities()); }
@@ -128,10 +130,14 @@ namespace OpenLoco::EntityManager
         return _entitySpatialIndex[index];
     }
 
+    static EntityId& getNextQuadrantId(EntityId id)
+    {
+        return rawEntities()[enumValue(id)].nextQuadrantId;
+    }
+
     static void insertToSpatialIndex(EntityBase& entity, const size_t newIndex)
     {
-        entity.nextQuadrantId = _entitySpatialIndex[newIndex];
-        _entitySpatialIndex[newIndex] = entity.id;
+        _spatialLinks.insert(&_entitySpatialIndex[0], newIndex, entity.id, getNextQuadrantId);
     }
 
     static void insertToSpatialIndex(EntityBase& entity)
@@ -145,6 +151,7 @@ namespace OpenLoco::EntityManager
     {
         // Clear existing array
         std::fill(std::begin(_entitySpatialIndex), std::end(_entitySpatialIndex), EntityId::null);
+        _spatialLinks.reset();
 
         // Original filled an unreferenced array at 0x010A5A8E as well then overwrote part of it???
 
@@ -166,24 +173,7 @@ namespace OpenLoco::EntityManager
 
     static bool removeFromSpatialIndex(EntityBase& entity, const size_t index)
     {
-        auto* quadId = &_entitySpatialIndex[index];
-        _entitySpatialCount = 0;
-        while (enumValue(*quadId) < Limits::kMaxEntities)
-        {
-            auto* quadEnt = get<EntityBase>(*quadId);
-            if (quadEnt == &entity)
-            {
-                *quadId = entity.nextQuadrantId;
-                return true;
-            }
-            _entitySpatialCount++;
-            if (_entitySpatialCount > Limits::kMaxEntities)
-            {
-                break;
-            }
-            quadId = &quadEnt->nextQuadrantId;
-        }
-        return false;
+        return _spatialLinks.remove(&_entitySpatialIndex[0], index, entity.id, getNextQuadrantId);
     }
 
     static bool removeFromSpatialIndex(EntityBase& entity)
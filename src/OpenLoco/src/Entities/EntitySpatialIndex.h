@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace OpenLoco::EntityManager
+{
+    /**
+     * The entities on each tile form a singly linked list through EntityBase::nextQuadrantId.
+     * The lists are shared with the original game so their layout can not change. To unlink an
+     * entity without walking the list from the head, the previous entity and the list of each
+     * entity are kept on the side.
+     *
+     * Code of the original game can still change the lists without updating the links, so a
+     * link is checked before it is used and removal falls back to walking the list.
+     */
+    class SpatialLinks
+    {
+    private:
+        static constexpr uint32_t kNotLinked = std::numeric_limits<uint32_t>::max();
+
+        struct Link
+        {
+            EntityId previous = EntityId::null;
+            uint32_t index = kNotLinked;
+        };
+
+        std::vector<Link> _links;
+
+        bool isEntity(EntityId id) const
+        {
+            return enumValue(id) < _links.size();
+        }
+
+        // Finds the previous entity by walking the list, returns false if id is not on it
+        template<typename TGetNext>
+        bool findPrevious(EntityId head, EntityId id, TGetNext&& getNext, EntityId& previous) const
+        {
+            previous = EntityId::null;
+            auto current = head;
+            for (size_t count = 0; isEntity(current) && count < _links.size(); count++)
+            {
+                if (current == id)
+                {
+                    return true;
+                }
+                previous = current;
+                current = getNext(current);
+            }
+            return false;
+        }
+
+    public:
+        explicit SpatialLinks(size_t maxEntities)
+            : _links(maxEntities)
+        {
+        }
+
+        void reset()
+        {
+            std::fill(_links.begin(), _links.end(), Link{});
+        }
+
+        // getNext(id) must return a reference to the next id of the entity
+        template<typename TGetNext>
+        void insert(EntityId* heads, size_t index, EntityId id, TGetNext&& getNext)
+        {
+            auto& head = heads[index];
+            if (isEntity(head))
+            {
+                _links[enumValue(head)].previous = id;
+            }
+            getNext(id) = head;
+            head = id;
+            _links[enumValue(id)] = { EntityId::null, static_cast<uint32_t>(index) };
+        }
+
+        // Returns false if the entity is not on the list at index
+        template<typename TGetNext>
+        bool remove(EntityId* heads, size_t index, EntityId id, TGetNext&& getNext)
+        {
+            auto& head = heads[index];
+            auto previous = _links[enumValue(id)].previous;
+            bool isLinked = previous == EntityId::null
+                ? head == id
+                : isEntity(previous) && _links[enumValue(previous)].index == index && getNext(previous) == id;
+            if (!isLinked && !findPrevious(head, id, getNext, previous))
+            {
+                return false;
+            }
+
+            auto next = getNext(id);
+            if (previous == EntityId::null)
+            {
+                head = next;
+            }
+            else
+            {
+                getNext(previous) = next;
+            }
+            if (isEntity(next))
+            {
+                _links[enumValue(next)].previous = previous;
+            }
+
+            // The next id of the entity is left alone as code of the original game may still be
+            // iterating the list, the cleared link stops it from being used as a previous entity
+            _links[enumValue(id)] = {};
+            return true;
+        }
+    };
+}
@@ -2,16 +2,55 @@
 #include "Entity.h"
 #include "OpenLoco.h"
 #include "Vehicles/Vehicle.h"
-#include <cmath>
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 namespace OpenLoco
 {
     using EntityListType = EntityManager::EntityListType;
     using EntityListIterator = EntityManager::ListIterator<EntityBase, &EntityBase::nextThingId>;
 
+    static constexpr uint16_t kNoSlot = std::numeric_limits<uint16_t>::max();
+    static_assert(Limits::kMaxEntities < kNoSlot);
+
+    void EntityTweener::Positions::push_back(const World::Pos3& pos)
+    {
+        x.push_back(pos.x);
+        y.push_back(pos.y);
+        z.push_back(pos.z);
+    }
+
+    void EntityTweener::Positions::swapAndPop(size_t index)
+    {
+        if (index >= size())
+        {
+            return;
+        }
+        x[index] = x.back();
+        y[index] = y.back();
+        z[index] = z.back();
+        x.pop_back();
+        y.pop_back();
+        z.pop_back();
+    }
+
+    void EntityTweener::Positions::resize(size_t size)
+    {
+        x.resize(size);
+        y.resize(size);
+        z.resize(size);
+    }
+
+    void EntityTweener::Positions::clear()
+    {
+        x.clear();
+        y.clear();
+        z.clear();
+    }
+
     template<EntityListType id, typename Pred>
-    void PopulateEntities(std::vector<EntityBase*>& list, std::vector<World::Pos3>& posList, const Pred& pred)
+    void EntityTweener::populateEntities(const Pred& pred)
     {
         auto entsView = EntityManager::EntityList<EntityListIterator, id>();
         for (auto* ent : entsView)
@@ -19,13 +58,20 @@ namespace OpenLoco
             if (!pred(ent))
                 continue;
 
-            list.push_back(ent);
-            posList.emplace_back(ent->position);
+            _slots[enumValue(ent->id)] = static_cast<uint16_t>(_entities.size());
+            _entities.push_back(ent);
+            _ids.push_back(ent->id);
+            _prePos.push_back(ent->position);
         }
     }
 
     static EntityTweener _tweener;
 
+    EntityTweener::EntityTweener()
+        : _slots(Limits::kMaxEntities, kNoSlot)
+    {
+    }
+
     EntityTweener& EntityTweener::get()
     {
         return _tweener;
@@ -35,8 +81,8 @@ namespace OpenLoco
     {
         restore();
         reset();
-        PopulateEntities<EntityListType::misc>(_entities, _prePos, [](auto*) { return true; });
-        PopulateEntities<EntityListType::vehicle>(_entities, _prePos, [](auto* ent) {
+        populateEntities<EntityListType::misc>([](auto*) { return true; });
+        populateEntities<EntityListType::vehicle>([](auto* ent) {
             const auto* vehicle = ent->template asBase<Vehicles::VehicleBase>();
             if (vehicle == nullptr)
             {
@@ -49,49 +95,66 @@ namespace OpenLoco
 
     void EntityTweener::postTick()
     {
+        // Removed entities have already been dropped so every slot is still alive.
+        _postPos.clear();
         for (auto* ent : _entities)
         {
-            if (ent == nullptr || ent->id == EntityId::null)
-            {
-                // Sprite was removed, add a dummy position to keep the index aligned.
-                _postPos.emplace_back(0, 0, 0);
-            }
-            else
-            {
-                _postPos.emplace_back(ent->position);
-            }
+            _postPos.push_back(ent->position);
         }
     }
 
     void EntityTweener::removeEntity(const EntityBase* entity)
     {
-        auto it = std::find(_entities.begin(), _entities.end(), entity);
-        if (it != _entities.end())
+        const auto id = enumValue(entity->id);
+        if (id >= _slots.size() || _slots[id] == kNoSlot)
+        {
+            return;
+        }
+
+        // Move the last entity into the slot of the removed one.
+        const auto slot = _slots[id];
+        _slots[id] = kNoSlot;
+        if (slot != _entities.size() - 1)
         {
-            *it = nullptr;
+            _slots[enumValue(_ids.back())] = slot;
         }
+        _entities[slot] = _entities.back();
+        _ids[slot] = _ids.back();
+        _entities.pop_back();
+        _ids.pop_back();
+        _prePos.swapAndPop(slot);
+        _postPos.swapAndPop(slot);
+        _tweenPos.swapAndPop(slot);
     }
 
     void EntityTweener::tween(float alpha)
     {
-        const float inv = (1.0f - alpha);
+        const size_t count = std::min(_entities.size(), _postPos.size());
+
+        // Interpolate all positions first in 15 bit fixed point, the products of a position
+        // delta and the factor still fit in 32 bits. Being integer only without branches
+        // this loop can be vectorised.
+        constexpr int32_t kAlphaShift = 15;
+        const auto alphaFixed = static_cast<int32_t>(std::clamp(alpha, 0.0f, 1.0f) * (1 << kAlphaShift) + 0.5f);
+        _tweenPos.resize(count);
+        const auto interpolate = [&](const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& out) {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const int32_t delta = b[i] - a[i];
+                out[i] = static_cast<int16_t>(a[i] + ((delta * alphaFixed + (1 << (kAlphaShift - 1))) >> kAlphaShift));
+            }
+        };
+        interpolate(_prePos.x, _postPos.x, _tweenPos.x);
+        interpolate(_prePos.y, _postPos.y, _tweenPos.y);
+        interpolate(_prePos.z, _postPos.z, _tweenPos.z);
 
-        for (size_t i = 0; i < _entities.size(); ++i)
+        for (size_t i = 0; i < count; ++i)
         {
-            auto* ent = _entities[i];
-            if (ent == nullptr)
+            if (_prePos.x[i] == _postPos.x[i] && _prePos.y[i] == _postPos.y[i] && _prePos.z[i] == _postPos.z[i])
                 continue;
 
-            auto& posA = _prePos[i];
-            auto& posB = _postPos[i];
-
-            if (posA == posB)
-                continue;
-
-            auto newPos = World::Pos3{ static_cast<int16_t>(std::round(posB.x * alpha + posA.x * inv)),
-                                       static_cast<int16_t>(std::round(posB.y * alpha + posA.y * inv)),
-                                       static_cast<int16_t>(std::round(posB.z * alpha + posA.z * inv)) };
-
+            auto* ent = _entities[i];
+            const auto newPos = _tweenPos[i];
             if (ent->position == newPos)
                 continue;
 
@@ -102,13 +165,11 @@ namespace OpenLoco
 
     void EntityTweener::restore()
     {
-        for (size_t i = 0; i < _entities.size(); ++i)
+        const size_t count = std::min(_entities.size(), _postPos.size());
+        for (size_t i = 0; i < count; ++i)
         {
             auto* ent = _entities[i];
-            if (ent == nullptr)
-                continue;
-
-            auto& newPos = _postPos[i];
+            const auto newPos = _postPos[i];
 
             if (ent->position == newPos)
                 continue;
@@ -120,9 +181,16 @@ namespace OpenLoco
 
     void EntityTweener::reset()
     {
+        // Only the ids are used as the entities may already have been overwritten.
+        for (const auto id : _ids)
+        {
+            _slots[enumValue(id)] = kNoSlot;
+        }
         _entities.clear();
+        _ids.clear();
         _prePos.clear();
         _postPos.clear();
+        _tweenPos.clear();
     }
 
 }
@@ -8,11 +8,35 @@ namespace OpenLoco
 {
     class EntityTweener
     {
+        // Positions are kept as separate arrays so the interpolation can be vectorised.
+        struct Positions
+        {
+            std::vector<int16_t> x;
+            std::vector<int16_t> y;
+            std::vector<int16_t> z;
+
+            size_t size() const { return x.size(); }
+            void push_back(const World::Pos3& pos);
+            void swapAndPop(size_t index);
+            void resize(size_t size);
+            void clear();
+            World::Pos3 operator[](size_t index) const { return World::Pos3(x[index], y[index], z[index]); }
+        };
+
         std::vector<EntityBase*> _entities;
-        std::vector<World::Pos3> _prePos;
-        std::vector<World::Pos3> _postPos;
+        std::vector<EntityId> _ids;
+        // Slot of each entity id in _entities, kNoSlot when not tweened.
+        std::vector<uint16_t> _slots;
+        Positions _prePos;
+        Positions _postPos;
+        Positions _tweenPos;
+
+        template<EntityManager::EntityListType id, typename Pred>
+        void populateEntities(const Pred& pred);
 
     public:
+        EntityTweener();
+
         static EntityTweener& get();
 
         void preTick();
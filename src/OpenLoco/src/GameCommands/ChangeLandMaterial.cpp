@@ -32,6 +32,7 @@ namespace OpenLoco::GameCommands
                 continue;
 
             surface->setTerrain(landType);
+            World::TileManager::invalidateSurfaceCounts(tilePos);
             if (!surface->isIndustrial())
             {
                 surface->setVar6SLR5(0);
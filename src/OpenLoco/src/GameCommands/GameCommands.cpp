@@ -5,6 +5,7 @@
 #include "Map/RoadElement.h"
 #include "Map/StationElement.h"
 #include "Map/Tile.h"
+#include "Map/TileManager.h"
 #include "Map/TrackElement.h"
 #include "Network/Network.h"
 #include "Objects/ObjectManager.h"
@@ -254,8 +255,15 @@ namespace OpenLoco::GameCommands
         }
         else
         {
+            const bool isApplied = (regs.bl & Flags::apply) != 0;
             auto addr = gameCommand.originalAddress;
             call(addr, regs);
+
+            // Commands of the original game do not mark the surfaces they change
+            if (isApplied)
+            {
+                World::TileManager::invalidateAllSurfaceCounts();
+            }
         }
     }
 
@@ -14,13 +14,17 @@
 #include "Ui.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Platform/MemoryMappedFile.h>
 #include <OpenLoco/Utility/Stream.hpp>
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <numeric>
+#include <optional>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Utility;
@@ -34,7 +38,7 @@ namespace OpenLoco::Gfx
 
     static loco_global<G1Element[G1ExpectedCount::kDisc + kG1CountTemporary + G1ExpectedCount::kObjects], 0x9E2424> _g1Elements;
 
-    static std::unique_ptr<std::byte[]> _g1Buffer;
+    static Platform::MemoryMappedFile _g1File;
 
     static loco_global<uint8_t[224 * 4], 0x112C884> _characterWidths;
 
@@ -51,33 +55,46 @@ namespace OpenLoco::Gfx
         }
     }
 
-    static std::vector<G1Element> convertElements(const std::vector<G1Element32>& elements32)
+    // The steam G1.DAT is missing two localised tutorial icons, and a smaller font variant.
+    // Returns the index of the element in the file to use for element index (the disc layout),
+    // the closest variants take the place of the missing elements and other elements are moved accordingly.
+    static std::optional<uint32_t> getSteamElementIndex(uint32_t index)
     {
-        auto elements = std::vector<G1Element>();
-        elements.reserve(elements32.size());
-        std::transform(
-            elements32.begin(),
-            elements32.end(),
-            std::back_inserter(elements),
-            [](G1Element32 src) { return G1Element(src); });
-        return elements;
+        // Extra font variant
+        if (index >= 3898 && index < 3898 + 223)
+        {
+            return 1788 + (index - 3898);
+        }
+        // Extra two tutorial images
+        if (index == 3549 || index == 3550)
+        {
+            return 3549;
+        }
+        if (index >= 3551)
+        {
+            const auto fileIndex = index - 2;
+            if (fileIndex >= G1ExpectedCount::kSteam)
+            {
+                return std::nullopt;
+            }
+            return fileIndex;
+        }
+        return index;
     }
 
     // 0x0044733C
     void loadG1()
     {
         auto g1Path = Environment::getPath(Environment::PathId::g1);
-        std::ifstream stream(g1Path, std::ios::in | std::ios::binary);
-        if (!stream)
-        {
-            throw std::runtime_error("Opening g1 file failed.");
-        }
+        // Element data is only read from disk when a sprite is first drawn
+        auto g1File = Platform::MemoryMappedFile(g1Path);
 
         G1Header header;
-        if (!readData(stream, header))
+        if (g1File.size() < sizeof(header))
         {
             throw std::runtime_error("Reading g1 file header failed.");
         }
+        std::memcpy(&header, g1File.data(), sizeof(header));
 
         if (header.numEntries != G1ExpectedCount::kDisc)
         {
@@ -88,63 +105,53 @@ namespace OpenLoco::Gfx
             }
         }
 
-        // Read element headers
-        auto elements32 = std::vector<G1Element32>(header.numEntries);
-        if (!readData(stream, elements32.data(), header.numEntries))
+        const auto elementsOffset = sizeof(header);
+        const auto dataOffset = elementsOffset + static_cast<size_t>(header.numEntries) * sizeof(G1Element32);
+        if (g1File.size() < dataOffset)
         {
             throw std::runtime_error("Reading g1 element headers failed.");
         }
-        auto elements = convertElements(elements32);
-
-        // Read element data
-        auto elementData = std::make_unique<std::byte[]>(header.totalSize);
-        if (!readData(stream, elementData.get(), header.totalSize))
+        if (g1File.size() - dataOffset < header.totalSize)
         {
             throw std::runtime_error("Reading g1 elements failed.");
         }
-        stream.close();
+        const auto* elements32 = reinterpret_cast<const G1Element32*>(g1File.data() + elementsOffset);
+        auto* elementData = g1File.data() + dataOffset;
+
+        auto readElement = [&](uint32_t fileIndex) {
+            G1Element element(elements32[fileIndex]);
+            element.offset += reinterpret_cast<uintptr_t>(elementData);
+            return element;
+        };
 
-        // The steam G1.DAT is missing two localised tutorial icons, and a smaller font variant
-        // This code copies the closest variants into their place, and moves other elements accordingly
         if (header.numEntries == G1ExpectedCount::kSteam)
         {
-            // Temporarily convert offsets to absolute indexes
-            for (size_t i = 0; i < elements.size(); i++)
+            for (uint32_t i = 0; i < G1ExpectedCount::kDisc; i++)
             {
-                if (elements[i].hasFlags(G1ElementFlags::hasZoomSprites))
+                const auto fileIndex = getSteamElementIndex(i);
+                if (!fileIndex.has_value())
                 {
-                    elements[i].zoomOffset = static_cast<int16_t>(i - elements[i].zoomOffset);
+                    _g1Elements[i] = G1Element{};
+                    continue;
                 }
-            }
-
-            elements.resize(G1ExpectedCount::kDisc);
-
-            // Extra two tutorial images
-            std::copy_n(&elements[3549], header.numEntries - 3549, &elements[3551]);
-            std::copy_n(&elements[3551], 1, &elements[3549]);
-            std::copy_n(&elements[3551], 1, &elements[3550]);
-
-            // Extra font variant
-            std::copy_n(&elements[1788], 223, &elements[3898]);
-
-            // Restore relative offsets
-            for (size_t i = 0; i < elements.size(); i++)
-            {
-                if (elements[i].hasFlags(G1ElementFlags::hasZoomSprites))
+                auto element = readElement(*fileIndex);
+                if (element.hasFlags(G1ElementFlags::hasZoomSprites))
                 {
-                    elements[i].zoomOffset = static_cast<int16_t>(i - elements[i].zoomOffset);
+                    // Zoom offsets are relative so keep them pointing at the same file index
+                    element.zoomOffset = static_cast<int16_t>(element.zoomOffset + (i - *fileIndex));
                 }
+                _g1Elements[i] = element;
             }
         }
-
-        // Adjust memory offsets
-        for (auto& element : elements)
+        else
         {
-            element.offset += (uintptr_t)elementData.get();
+            for (uint32_t i = 0; i < header.numEntries; i++)
+            {
+                _g1Elements[i] = readElement(i);
+            }
         }
 
-        _g1Buffer = std::move(elementData);
-        std::copy(elements.begin(), elements.end(), _g1Elements.get());
+        _g1File = std::move(g1File);
     }
 
     // 0x004949BC
@@ -345,10 +352,14 @@ namespace OpenLoco::Gfx
         getDrawingEngine().updatePalette(_113ED20, 10, 236);
     }
 
+    // Size of the bitmap vanilla drew the images onto, centred on the origin
+    static constexpr int32_t kExtentsBitmapSize = 200;
+
     // 0x004530F8
-    ImageExtents getImagesMaxExtent(const ImageId baseImageId, const size_t numImages)
+    // Draws all the images and scans the result, used when the drawn pixels can not be worked out from the sprite data
+    static ImageExtents getImagesMaxExtentByDrawing(const ImageId baseImageId, const size_t numImages)
     {
-        uint8_t bitmap[200][200] = {};
+        uint8_t bitmap[kExtentsBitmapSize][kExtentsBitmapSize] = {};
 
         RenderTarget rt = {
             /*.bits = */ reinterpret_cast<uint8_t*>(bitmap),
@@ -436,4 +447,168 @@ namespace OpenLoco::Gfx
 
         return ImageExtents{ static_cast<uint8_t>(spriteWidth), static_cast<uint8_t>(spriteHeightNegative), static_cast<uint8_t>(spriteHeightPositive) };
     }
+
+    // Tracks the furthest drawn pixel from the origin in each direction in the same way
+    // as scanning vanilla's bitmap did (the outermost row and column were never checked)
+    class ImageExtentsBuilder
+    {
+    private:
+        static constexpr int32_t kMaxDistance = kExtentsBitmapSize / 2 - 1;
+
+        int32_t _width = 0;
+        int32_t _heightNegative = 0;
+        int32_t _heightPositive = 0;
+
+    public:
+        void addPixel(int32_t x, int32_t y)
+        {
+            // Pixels outside of the bitmap were clipped
+            if (x < -kMaxDistance - 1 || x > kMaxDistance || y < -kMaxDistance - 1 || y > kMaxDistance)
+            {
+                return;
+            }
+            if (x != 0 && x >= -kMaxDistance)
+            {
+                _width = std::max(_width, std::abs(x) + 1);
+            }
+            if (y < 0 && y >= -kMaxDistance)
+            {
+                _heightNegative = std::max(_heightNegative, -y + 1);
+            }
+            else if (y > 0)
+            {
+                _heightPositive = std::max(_heightPositive, y + 1);
+            }
+        }
+
+        ImageExtents get() const
+        {
+            return ImageExtents{ static_cast<uint8_t>(_width), static_cast<uint8_t>(_heightNegative), static_cast<uint8_t>(_heightPositive) };
+        }
+    };
+
+    // Adds the pixels that would be drawn at zoom level 0 from the run tables (see DrawSpriteRLE.hpp).
+    // Returns false if the result depends on the draw order and must be found by drawing.
+    static bool addRLEImageExtents(ImageExtentsBuilder& builder, const G1Element& element, const ImageId image, const PaletteMap::View palette)
+    {
+        // Matches the blend op chosen by Drawing::getDrawBlendOp
+        const bool usePalette = image.hasPrimary();
+        const bool skipTransparent = usePalette || element.hasFlags(G1ElementFlags::hasTransparancy);
+
+        const auto* src0 = element.offset;
+        for (int32_t y = 0; y < element.height; y++)
+        {
+            const uint16_t lineOffset = src0[y * 2] | (src0[y * 2 + 1] << 8);
+            const auto* nextRun = src0 + lineOffset;
+            auto isEndOfLine = false;
+            while (!isEndOfLine)
+            {
+                const auto* src = nextRun;
+                const int32_t dataSize = *src & 0x7F;
+                isEndOfLine = (*src++ & 0x80) != 0;
+                const int32_t firstPixelX = *src++;
+                nextRun = src + dataSize;
+
+                const auto numPixels = std::min(dataSize, element.width - firstPixelX);
+                for (int32_t i = 0; i < numPixels; i++)
+                {
+                    const auto pixel = usePalette ? palette[src[i]] : src[i];
+                    if (pixel == PaletteIndex::transparent)
+                    {
+                        if (!skipTransparent)
+                        {
+                            // A transparent pixel would overwrite what previous images drew
+                            return false;
+                        }
+                        continue;
+                    }
+                    builder.addPixel(element.xOffset + firstPixelX + i, element.yOffset + y);
+                }
+            }
+        }
+        return true;
+    }
+
+    static ImageExtents computeImagesMaxExtent(const ImageId baseImageId, const size_t numImages)
+    {
+        if (baseImageId.isBlended())
+        {
+            return getImagesMaxExtentByDrawing(baseImageId, numImages);
+        }
+        for (size_t i = 0; i < numImages; ++i)
+        {
+            const auto* element = getG1Element(baseImageId.withIndexOffset(i).getIndex());
+            if (element == nullptr || !element->hasFlags(G1ElementFlags::isRLECompressed))
+            {
+                return getImagesMaxExtentByDrawing(baseImageId, numImages);
+            }
+        }
+
+        const auto palette = PaletteMap::getForImage(baseImageId).value_or(PaletteMap::getDefault());
+        ImageExtentsBuilder builder;
+        for (size_t i = 0; i < numImages; ++i)
+        {
+            const auto image = baseImageId.withIndexOffset(i);
+            if (!addRLEImageExtents(builder, *getG1Element(image.getIndex()), image, palette))
+            {
+                return getImagesMaxExtentByDrawing(baseImageId, numImages);
+            }
+        }
+
+        return builder.get();
+    }
+
+    struct CachedImageExtents
+    {
+        // The elements the extents were computed from, reloading an object in place loads the same ones again
+        std::vector<G1Element> elements;
+        ImageExtents extents;
+    };
+
+    // Keyed by the base image (including its flags) and the number of images. Entries are only used
+    // while the elements at those indices are unchanged, and are dropped when object data is freed
+    // so that an unchanged element also points at unchanged image data.
+    static std::map<std::pair<uint32_t, size_t>, CachedImageExtents> _imageExtentsCache;
+
+    static bool isSameElement(const G1Element& a, const G1Element& b)
+    {
+        return a.offset == b.offset && a.width == b.width && a.height == b.height && a.xOffset == b.xOffset
+            && a.yOffset == b.yOffset && a.flags == b.flags && a.zoomOffset == b.zoomOffset;
+    }
+
+    static std::vector<G1Element> getElements(const ImageId baseImageId, const size_t numImages)
+    {
+        std::vector<G1Element> elements(numImages);
+        for (size_t i = 0; i < numImages; ++i)
+        {
+            const auto* element = getG1Element(baseImageId.withIndexOffset(i).getIndex());
+            if (element != nullptr)
+            {
+                elements[i] = *element;
+            }
+        }
+        return elements;
+    }
+
+    // 0x004530F8
+    ImageExtents getImagesMaxExtent(const ImageId baseImageId, const size_t numImages)
+    {
+        auto elements = getElements(baseImageId, numImages);
+        const auto key = std::make_pair(baseImageId.toUInt32(), numImages);
+        auto cached = _imageExtentsCache.find(key);
+        if (cached != _imageExtentsCache.end()
+            && std::equal(elements.begin(), elements.end(), cached->second.elements.begin(), isSameElement))
+        {
+            return cached->second.extents;
+        }
+
+        const auto extents = computeImagesMaxExtent(baseImageId, numImages);
+        _imageExtentsCache[key] = CachedImageExtents{ std::move(elements), extents };
+        return extents;
+    }
+
+    void invalidateImageExtentsCache()
+    {
+        _imageExtentsCache.clear();
+    }
 }
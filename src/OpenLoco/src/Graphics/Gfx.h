@@ -144,4 +144,6 @@ namespace OpenLoco::Gfx
     void loadPalette();
 
     ImageExtents getImagesMaxExtent(const ImageId baseImageId, const size_t numImages);
+    // Must be called when the data of loaded images is freed
+    void invalidateImageExtentsCache();
 }
@@ -1842,6 +1842,12 @@ namespace OpenLoco::StringIds
     constexpr string_id disableTownExpansion_tip = 2272;
     constexpr string_id completeChallenge = 2273;
     constexpr string_id clearInput = 2274;
+    constexpr string_id landscape_seed = 2275;
+    constexpr string_id landscape_seed_value = 2276;
+    constexpr string_id landscape_seed_random = 2277;
+    constexpr string_id tooltip_landscape_seed = 2278;
+    constexpr string_id title_landscape_seed = 2279;
+    constexpr string_id prompt_enter_landscape_seed = 2280;
 
     constexpr string_id temporary_object_load_str_0 = 8192;
     constexpr string_id temporary_object_load_str_1 = 8193;
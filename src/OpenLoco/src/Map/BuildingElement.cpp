@@ -99,6 +99,7 @@ namespace OpenLoco::World
                 }
             }
             setConstructed(isConstructed);
+            invalidateTileCargo(TilePos2(loc));
             setUnk5u(newUnk5u);
             setAge(newAge);
             Ui::ViewportManager::invalidate(loc, baseHeight(), clearHeight(), ZoomLevel::quarter);
@@ -120,6 +121,7 @@ namespace OpenLoco::World
                             continue;
                         }
                         elBuilding2->setConstructed(isConstructed);
+                        invalidateTileCargo(TilePos2(pos));
                         elBuilding2->setUnk5u(newUnk5u);
                         elBuilding2->setAge(newAge);
                         Ui::ViewportManager::invalidate(pos, elBuilding2->baseHeight(), elBuilding2->clearHeight(), ZoomLevel::quarter);
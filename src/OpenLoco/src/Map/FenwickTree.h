@@ -0,0 +1,105 @@
+#pragma once
+
+#include <OpenLoco/Engine/World.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace OpenLoco::World
+{
+    // Sums a value of every tile over any rectangle of the map. The value of a single tile can
+    // be changed without building it again.
+    class FenwickTree
+    {
+    private:
+        static constexpr int32_t kPitch = kMapColumns + 1;
+
+        // Row and column 0 are unused, entry (x, y) holds the sum of the tiles
+        // (x - lowbit(x), x] by (y - lowbit(y), y]
+        std::vector<int32_t> _sums;
+
+        static int32_t lowestBit(int32_t i)
+        {
+            return i & -i;
+        }
+
+        // Sum of all tiles above and left of (x, y)
+        int32_t prefixSum(int32_t x, int32_t y) const
+        {
+            int32_t sum = 0;
+            for (int32_t j = y; j > 0; j -= lowestBit(j))
+            {
+                for (int32_t i = x; i > 0; i -= lowestBit(i))
+                {
+                    sum += _sums[j * kPitch + i];
+                }
+            }
+            return sum;
+        }
+
+    public:
+        // getValue(TilePos2) is called once for every tile of the map
+        template<typename TGetValue>
+        void build(TGetValue&& getValue)
+        {
+            _sums.assign(kPitch * (kMapRows + 1), 0);
+            for (coord_t y = 0; y < kMapRows; y++)
+            {
+                for (coord_t x = 0; x < kMapColumns; x++)
+                {
+                    _sums[(y + 1) * kPitch + x + 1] = getValue(TilePos2(x, y));
+                }
+            }
+
+            // Add every entry to its parent along each axis, which makes every entry hold its range
+            for (int32_t y = 1; y <= kMapRows; y++)
+            {
+                for (int32_t x = 1; x <= kMapColumns; x++)
+                {
+                    const auto parent = x + lowestBit(x);
+                    if (parent <= kMapColumns)
+                    {
+                        _sums[y * kPitch + parent] += _sums[y * kPitch + x];
+                    }
+                }
+            }
+            for (int32_t y = 1; y <= kMapRows; y++)
+            {
+                const auto parent = y + lowestBit(y);
+                if (parent > kMapRows)
+                {
+                    continue;
+                }
+                for (int32_t x = 1; x <= kMapColumns; x++)
+                {
+                    _sums[parent * kPitch + x] += _sums[y * kPitch + x];
+                }
+            }
+        }
+
+        void add(const TilePos2& pos, int32_t delta)
+        {
+            for (int32_t j = pos.y + 1; j <= kMapRows; j += lowestBit(j))
+            {
+                for (int32_t i = pos.x + 1; i <= kMapColumns; i += lowestBit(i))
+                {
+                    _sums[j * kPitch + i] += delta;
+                }
+            }
+        }
+
+        // Sum of the tiles from topLeft to bottomRight inclusive, tiles outside of the map count as zero
+        uint32_t sum(const TilePos2& topLeft, const TilePos2& bottomRight) const
+        {
+            const int32_t left = std::clamp<int32_t>(topLeft.x, 0, kMapColumns);
+            const int32_t top = std::clamp<int32_t>(topLeft.y, 0, kMapRows);
+            const int32_t right = std::clamp<int32_t>(bottomRight.x + 1, 0, kMapColumns);
+            const int32_t bottom = std::clamp<int32_t>(bottomRight.y + 1, 0, kMapRows);
+            if (left >= right || top >= bottom)
+            {
+                return 0;
+            }
+            return static_cast<uint32_t>(prefixSum(right, bottom) - prefixSum(left, bottom) - prefixSum(right, top) + prefixSum(left, top));
+        }
+    };
+}
@@ -1,4 +1,5 @@
 #include "MapGenerator.h"
+#include "CommandLine.h"
 #include "LastGameOptionManager.h"
 #include "Localisation/StringIds.h"
 #include "Objects/LandObject.h"
@@ -14,6 +15,7 @@
 #include "TreeElement.h"
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
+#include <OpenLoco/Core/ThreadPool.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <cassert>
 #include <cstdint>
@@ -128,6 +130,11 @@ namespace OpenLoco::World::MapGenerator
             return _heightMap[pos];
         }
 
+        uint8_t* row(int32_t y)
+        {
+            return &(*this)[{ 0, y }];
+        }
+
         HeightMapRange slice(int32_t l, int32_t t, int32_t w, int32_t h)
         {
             return HeightMapRange(_heightMap, _minX + l, _minY + t, w, h);
@@ -221,43 +228,68 @@ namespace OpenLoco::World::MapGenerator
             smooth(settings.smooth, heightMap);
         }
 
+        // Each row only depends on the permutation table, so the output does not depend on the number of threads
         void generateSimplex(const SimplexSettings& settings, HeightMapRange heightMap)
         {
             auto freq = settings.baseFreq * (1.0f / std::max(heightMap.width, heightMap.height));
             uint8_t perm[512];
             noise(perm, std::size(perm));
-            for (int32_t y = 0; y < heightMap.height; y++)
-            {
+            Core::ThreadPool::getShared().parallelFor(heightMap.height, [&](size_t y) {
+                auto* row = heightMap.row(static_cast<int32_t>(y));
                 for (int32_t x = 0; x < heightMap.width; x++)
                 {
-                    auto noiseValue = std::clamp(noiseFractal(perm, x, y, freq, settings.octaves, 2.0f, 0.65f), -1.0f, 1.0f);
+                    auto noiseValue = std::clamp(noiseFractal(perm, x, static_cast<int32_t>(y), freq, settings.octaves, 2.0f, 0.65f), -1.0f, 1.0f);
                     auto normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
                     auto height = settings.low + static_cast<int32_t>(normalisedNoiseValue * settings.high);
-                    heightMap[{ x, y }] = height;
+                    row[x] = height;
                 }
-            }
+            });
         }
 
+        // 3x3 box filter of the inner cells, summed as rows of 3 and then columns of 3 row sums
         static void smooth(int32_t iterations, HeightMapRange heightMap)
         {
+            constexpr int32_t kRowsPerItem = 16;
+
+            if (heightMap.width < 3 || heightMap.height < 3)
+            {
+                return;
+            }
+
+            auto& pool = Core::ThreadPool::getShared();
+            auto numItems = static_cast<size_t>((heightMap.height + kRowsPerItem - 1) / kRowsPerItem);
+            std::vector<uint16_t> rowSums(heightMap.width * heightMap.height);
             for (int32_t i = 0; i < iterations; i++)
             {
-                auto copyHeight = heightMap;
-                for (int32_t y = 1; y < heightMap.width - 1; y++)
-                {
-                    for (int32_t x = 1; x < heightMap.height - 1; x++)
+                pool.parallelFor(numItems, [&](size_t item) {
+                    auto minY = static_cast<int32_t>(item) * kRowsPerItem;
+                    auto maxY = std::min(minY + kRowsPerItem, heightMap.height);
+                    for (int32_t y = minY; y < maxY; y++)
                     {
-                        int32_t total = 0;
-                        for (int32_t yy = -1; yy <= 1; yy++)
+                        const auto* src = heightMap.row(y);
+                        auto* dst = &rowSums[y * heightMap.width];
+                        for (int32_t x = 1; x < heightMap.width - 1; x++)
                         {
-                            for (int32_t xx = -1; xx <= 1; xx++)
-                            {
-                                total += copyHeight[{ x + xx, y + yy }];
-                            }
+                            dst[x] = src[x - 1] + src[x] + src[x + 1];
                         }
-                        heightMap[{ x, y }] = total / 9;
                     }
-                }
+                });
+
+                pool.parallelFor(numItems, [&](size_t item) {
+                    auto minY = std::max(static_cast<int32_t>(item) * kRowsPerItem, 1);
+                    auto maxY = std::min(static_cast<int32_t>(item + 1) * kRowsPerItem, heightMap.height - 1);
+                    for (int32_t y = minY; y < maxY; y++)
+                    {
+                        const auto* above = &rowSums[(y - 1) * heightMap.width];
+                        const auto* middle = &rowSums[y * heightMap.width];
+                        const auto* below = &rowSums[(y + 1) * heightMap.width];
+                        auto* dst = heightMap.row(y);
+                        for (int32_t x = 1; x < heightMap.width - 1; x++)
+                        {
+                            dst[x] = (above[x] + middle[x] + below[x]) / 9;
+                        }
+                    }
+                });
             }
         }
 
@@ -392,6 +424,22 @@ namespace OpenLoco::World::MapGenerator
         }
     };
 
+    // The seed set in the editor takes precedence over the command line, without either a
+    // random one is picked
+    static uint32_t getModernGeneratorSeed(const S5::Options& options)
+    {
+        if (options.seed != 0)
+        {
+            return options.seed;
+        }
+        const auto& cmdSeed = getCommandLineOptions().landscapeSeed;
+        if (cmdSeed.has_value())
+        {
+            return static_cast<uint32_t>(*cmdSeed);
+        }
+        return std::random_device{}();
+    }
+
     // 0x004624F0
     static void generateHeightMap(const S5::Options& options, HeightMap& heightMap)
     {
@@ -403,7 +451,7 @@ namespace OpenLoco::World::MapGenerator
         else
         {
             ModernTerrainGenerator generator;
-            generator.generate(options, heightMap, std::random_device{}());
+            generator.generate(options, heightMap, getModernGeneratorSeed(options));
         }
     }
 
@@ -626,6 +674,12 @@ namespace OpenLoco::World::MapGenerator
         }
     }
 
+    // The original game stopped placing forests once fewer than 0x36000 elements were left at the
+    // end of the pool. Its allocator moved a tile to the end of the pool on every insert, so a tree
+    // on a bare tile used up two of them. Counted in free elements this is the same number of
+    // trees on a freshly generated map.
+    static constexpr auto kMinFreeElementsForForests = static_cast<uint32_t>((TileManager::maxElements - kMapSize + 0x36000) / 2);
+
     // 0x004BDA49
     static void generateTrees()
     {
@@ -639,7 +693,7 @@ namespace OpenLoco::World::MapGenerator
             const auto randDensity = (gPrng1().randNext(15) * std::max(options.maxForestDensity - options.minForestDensity, 0)) / 15 + options.minForestDensity;
             placeTreeCluster(randLoc, randRadius, randDensity, std::nullopt);
 
-            if (TileManager::numFreeElements() < 0x36000)
+            if (TileManager::numFreeElements() < kMinFreeElementsForForests)
             {
                 break;
             }
@@ -772,6 +826,8 @@ namespace OpenLoco::World::MapGenerator
         }
 
         call(0x004611DF);
+        // The water and terrain of the surfaces have been written directly
+        TileManager::invalidateAllSurfaceCounts();
         updateProgress(40);
 
         generateTrees();
@@ -787,6 +843,7 @@ namespace OpenLoco::World::MapGenerator
         updateProgress(250);
 
         call(0x004611DF);
+        TileManager::invalidateAllSurfaceCounts();
         updateProgress(255);
 
         call(0x004969E0);
@@ -68,6 +68,11 @@ namespace OpenLoco::World
             _flags &= ~ElementFlags::flag_6;
             _flags |= state == true ? ElementFlags::flag_6 : 0;
         }
+        void setOccupiedQuads(uint8_t quads)
+        {
+            _flags &= ~0xF;
+            _flags |= quads & 0xF;
+        }
         void setBaseZ(uint8_t baseZ) { _baseZ = baseZ; }
         void setClearZ(uint8_t value) { _clearZ = value; }
         bool isLast() const;
@@ -2,11 +2,14 @@
 #include "Audio/Audio.h"
 #include "BuildingElement.h"
 #include "Entities/Misc.h"
+#include "FenwickTree.h"
 #include "Game.h"
+#include "GameCommands/GameCommands.h"
 #include "GameState.h"
 #include "GameStateFlags.h"
 #include "IndustryElement.h"
 #include "Input.h"
+#include "Localisation/StringIds.h"
 #include "Objects/BuildingObject.h"
 #include "Objects/LandObject.h"
 #include "Objects/ObjectManager.h"
@@ -21,9 +24,14 @@
 #include "WallElement.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
+#include "World/Station.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -49,6 +57,219 @@ namespace OpenLoco::World::TileManager
 
     static TileElement* InvalidTile = reinterpret_cast<TileElement*>(static_cast<intptr_t>(-1));
 
+    // The elements of a tile are stored next to each other in a block of the element pool. A
+    // block can have free elements after the last element of its tile so that inserting does
+    // not have to move the tile. Blocks that are no longer used are merged with free neighbours
+    // and kept in free lists by size, they are split and reused before the pool grows. The
+    // capacity of a block is stored by the offset of its first element, blocks without one
+    // (loaded, or never changed since) have no spare elements. A tile only gets spare elements
+    // when it grows again after having changed before, so most tiles stay packed. The pool is
+    // only packed when loading, or before a game command when fewer than kReservedElements are
+    // left at its end.
+    constexpr size_t kMaxPooledBlockSize = 32; // Larger free blocks share the last free list
+    constexpr size_t kSpareElements = 2;
+    constexpr uint8_t kFreeElementBaseZ = 255;
+    // Elements that must be available for a game command to go ahead
+    constexpr size_t kReservedElements = 0x1000;
+
+    static std::vector<uint16_t> _blockCapacities(maxElements);
+    // Index in _tiles of the tile each block belongs to, also stored by the offset of its first element
+    static std::vector<uint32_t> _blockTiles(maxElements);
+    // Size of each free block, stored by the offsets of its first and last element so that
+    // neighbouring blocks can be merged. Free list entries of merged blocks are left behind and
+    // skipped when they no longer match.
+    static std::vector<uint32_t> _freeBlockSizes(maxElements);
+    static std::array<std::vector<uint32_t>, kMaxPooledBlockSize + 1> _freeBlocks;
+    static size_t _numUsedElements;
+
+    // Trees on every tile, indexed like _tiles. The original game inserts elements as surfaces
+    // and only then makes them trees (or ghosts), so a tile that had an element inserted or
+    // removed is only marked and its trees are counted again before the next query.
+    static std::vector<uint16_t> _treeCounts(kMapPitch * kMapRows);
+    static std::vector<bool> _isTreeCountDirty(kMapPitch * kMapRows);
+    static std::vector<uint32_t> _dirtyTreeTiles;
+    static FenwickTree _trees;
+
+    static void markTreeCountDirty(const TilePos2& pos)
+    {
+        const size_t index = (pos.y * kMapPitch) + pos.x;
+        if (!_isTreeCountDirty[index])
+        {
+            _isTreeCountDirty[index] = true;
+            _dirtyTreeTiles.push_back(static_cast<uint32_t>(index));
+        }
+    }
+
+    static bool isFreeElement(const TileElement& element)
+    {
+        return element.baseZ() == kFreeElementBaseZ;
+    }
+
+    static void markElementsAsFree(TileElement* elements, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            elements[i].setBaseZ(kFreeElementBaseZ);
+        }
+    }
+
+    static uint32_t getOffset(const TileElement* element)
+    {
+        return static_cast<uint32_t>(element - *_elements);
+    }
+
+    static TilePos2 getBlockTilePos(const TileElement* first)
+    {
+        const auto index = _blockTiles[getOffset(first)];
+        assert(_tiles[index] == first);
+        return TilePos2(static_cast<tile_coord_t>(index % kMapPitch), static_cast<tile_coord_t>(index / kMapPitch));
+    }
+
+    static size_t countTileElements(const TileElement* first)
+    {
+        size_t count = 1;
+        while (!first[count - 1].isLast())
+        {
+            count++;
+        }
+        return count;
+    }
+
+    static size_t getBlockCapacity(const TileElement* first, size_t numElements)
+    {
+        const auto capacity = _blockCapacities[getOffset(first)];
+        return capacity != 0 ? capacity : numElements;
+    }
+
+    // Elements after the end of the pool
+    static size_t numTailElements()
+    {
+        return maxElements - (_elementsEnd - _elements);
+    }
+
+    static void resetBlocks()
+    {
+        std::fill(_blockCapacities.begin(), _blockCapacities.end(), 0);
+        std::fill(_freeBlockSizes.begin(), _freeBlockSizes.end(), 0);
+        for (auto& freeBlocks : _freeBlocks)
+        {
+            freeBlocks.clear();
+        }
+    }
+
+    static void pushFreeBlock(uint32_t offset, size_t size)
+    {
+        _freeBlockSizes[offset] = static_cast<uint32_t>(size);
+        _freeBlockSizes[offset + size - 1] = static_cast<uint32_t>(size);
+        _freeBlocks[std::min(size, kMaxPooledBlockSize)].push_back(offset);
+    }
+
+    static void clearFreeBlock(uint32_t offset, size_t size)
+    {
+        _freeBlockSizes[offset] = 0;
+        _freeBlockSizes[offset + size - 1] = 0;
+    }
+
+    // Returns nullptr if there is no free block and the pool is full
+    static TileElement* allocateBlock(size_t capacity)
+    {
+        for (auto list = std::min(capacity, kMaxPooledBlockSize); list <= kMaxPooledBlockSize; list++)
+        {
+            auto& freeBlocks = _freeBlocks[list];
+            while (!freeBlocks.empty())
+            {
+                const auto offset = freeBlocks.back();
+                const size_t size = _freeBlockSizes[offset];
+                if (size == 0 || std::min(size, kMaxPooledBlockSize) != list || _freeBlockSizes[offset + size - 1] != size)
+                {
+                    // Merged into another block or already reused
+                    freeBlocks.pop_back();
+                    continue;
+                }
+                if (size < capacity)
+                {
+                    // Only possible in the list of large blocks, try the next entry
+                    break;
+                }
+
+                freeBlocks.pop_back();
+                clearFreeBlock(offset, size);
+                if (size > capacity)
+                {
+                    pushFreeBlock(offset + static_cast<uint32_t>(capacity), size - capacity);
+                }
+                _blockCapacities[offset] = static_cast<uint16_t>(capacity);
+                return *_elements + offset;
+            }
+        }
+
+        if (numTailElements() < capacity)
+        {
+            return nullptr;
+        }
+        auto* block = *_elementsEnd;
+        _elementsEnd = block + capacity;
+        _blockCapacities[getOffset(block)] = static_cast<uint16_t>(capacity);
+        return block;
+    }
+
+    static void freeBlock(TileElement* block, size_t capacity)
+    {
+        markElementsAsFree(block, capacity);
+        _blockCapacities[getOffset(block)] = 0;
+
+        auto offset = getOffset(block);
+        auto size = capacity;
+        if (offset > 0 && _freeBlockSizes[offset - 1] != 0)
+        {
+            const auto prevSize = _freeBlockSizes[offset - 1];
+            offset -= prevSize;
+            size += prevSize;
+            clearFreeBlock(offset, prevSize);
+        }
+        const auto end = offset + size;
+        if (*_elements + end != *_elementsEnd && _freeBlockSizes[end] != 0)
+        {
+            const auto nextSize = _freeBlockSizes[end];
+            size += nextSize;
+            clearFreeBlock(end, nextSize);
+        }
+
+        if (*_elements + offset + size == *_elementsEnd)
+        {
+            _elementsEnd = *_elements + offset;
+            return;
+        }
+        pushFreeBlock(offset, size);
+    }
+
+    // Moves a full tile to a larger block, returns nullptr if the pool is full
+    static TileElement* growBlock(TileElement* first, size_t numElements)
+    {
+        // Tiles that have not changed before are likely to stay as they are after this
+        const auto hasChanged = _blockCapacities[getOffset(first)] != 0;
+        const auto capacity = numElements + 1 + (hasChanged ? kSpareElements : 0);
+
+        // The last block of the pool can grow in place
+        if (first + numElements == *_elementsEnd && numTailElements() >= capacity - numElements)
+        {
+            _elementsEnd = first + capacity;
+            markElementsAsFree(first + numElements, capacity - numElements);
+            _blockCapacities[getOffset(first)] = static_cast<uint16_t>(capacity);
+            return first;
+        }
+
+        auto* block = allocateBlock(capacity);
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+        std::copy(first, first + numElements, block);
+        markElementsAsFree(block + numElements, capacity - numElements);
+        freeBlock(first, numElements);
+        return block;
+    }
+
     // 0x0046902E
     void removeSurfaceIndustry(const Pos2& pos)
     {
@@ -114,9 +335,10 @@ namespace OpenLoco::World::TileManager
         return _elementsEnd;
     }
 
+    // Elements not used by any tile, including those in free blocks and spare elements of tiles
     uint32_t numFreeElements()
     {
-        return maxElements - (_elementsEnd - _elements);
+        return static_cast<uint32_t>(maxElements - _numUsedElements);
     }
 
     void setElements(stdx::span<TileElement> elements)
@@ -127,14 +349,9 @@ namespace OpenLoco::World::TileManager
         TileManager::updateTilePointers();
     }
 
-    // Note: Must be past the last tile flag
-    static void markElementAsFree(TileElement& element)
+    static bool affectsTileCargo(ElementType type)
     {
-        element.setBaseZ(255);
-        if (element.next() == *_elementsEnd)
-        {
-            _elementsEnd--;
-        }
+        return type == ElementType::industry || type == ElementType::building || type == ElementType::station;
     }
 
     // 0x00461760
@@ -149,11 +366,31 @@ namespace OpenLoco::World::TileManager
             }
         }
 
+        // The freed element stays in the block of the tile, which starts after the last
+        // element of another tile or after a free element
+        auto* first = &element;
+        while (first != *_elements && !first->prev()->isLast() && !isFreeElement(*first->prev()))
+        {
+            first--;
+        }
+        if (_blockCapacities[getOffset(first)] == 0)
+        {
+            _blockCapacities[getOffset(first)] = static_cast<uint16_t>(countTileElements(first));
+        }
+        if (affectsTileCargo(element.type()))
+        {
+            invalidateTileCargo(getBlockTilePos(first));
+        }
+        if (element.type() == ElementType::tree)
+        {
+            markTreeCountDirty(getBlockTilePos(first));
+        }
+
         if (element.isLast())
         {
             auto* prev = element.prev();
             prev->setLastFlag(true);
-            markElementAsFree(element);
+            markElementsAsFree(&element, 1);
         }
         else
         {
@@ -165,21 +402,63 @@ namespace OpenLoco::World::TileManager
                 *cur++ = *next;
             } while (!next++->isLast());
 
-            markElementAsFree(*cur);
+            markElementsAsFree(cur, 1);
         }
+        _numUsedElements--;
     }
 
     // 0x004616D6
     TileElement* insertElement(ElementType type, const Pos2& pos, uint8_t baseZ, uint8_t occupiedQuads)
     {
-        registers regs;
-        regs.ax = pos.x;
-        regs.cx = pos.y;
-        regs.bl = baseZ;
-        regs.bh = occupiedQuads;
-        call(0x004616D6, regs);
-        TileElement* el = X86Pointer<TileElement>(regs.esi);
+        const auto tilePos = TilePos2(pos);
+        const size_t index = (tilePos.y * kMapPitch) + tilePos.x;
+        auto* first = _tiles[index];
+        if (first == InvalidTile)
+        {
+            return nullptr;
+        }
+
+        const auto numElements = countTileElements(first);
+        if (numElements == getBlockCapacity(first, numElements))
+        {
+            // checkFreeElementsAndReorganise has made sure the end of the pool has room
+            auto* block = growBlock(first, numElements);
+            assert(block != nullptr);
+            first = block;
+            _tiles[index] = first;
+            _blockTiles[getOffset(first)] = static_cast<uint32_t>(index);
+        }
+
+        // Elements are sorted by height, the new element goes after all elements at or below it
+        size_t insertIndex = 0;
+        while (insertIndex < numElements && first[insertIndex].baseZ() <= baseZ)
+        {
+            insertIndex++;
+        }
+        std::copy_backward(first + insertIndex, first + numElements, first + numElements + 1);
+
+        const bool isLast = insertIndex == numElements;
+        if (isLast)
+        {
+            first[numElements - 1].setLastFlag(false);
+        }
+
+        auto* el = first + insertIndex;
+        el->rawData().fill(0);
         el->setType(type);
+        el->setBaseZ(baseZ);
+        el->setClearZ(baseZ);
+        el->setOccupiedQuads(occupiedQuads);
+        el->setLastFlag(isLast);
+        _numUsedElements++;
+        if (affectsTileCargo(type))
+        {
+            invalidateTileCargo(tilePos);
+        }
+        if (type == ElementType::tree)
+        {
+            markTreeCountDirty(tilePos);
+        }
         return el;
     }
 
@@ -403,7 +682,52 @@ namespace OpenLoco::World::TileManager
 
     static void set(TilePos2 pos, TileElement* elements)
     {
-        _tiles[(pos.y * kMapPitch) + pos.x] = elements;
+        const size_t index = (pos.y * kMapPitch) + pos.x;
+        _tiles[index] = elements;
+        _blockTiles[getOffset(elements)] = static_cast<uint32_t>(index);
+    }
+
+    static uint16_t countTileTrees(const TilePos2& pos)
+    {
+        uint16_t count = 0;
+        for (auto& element : get(pos))
+        {
+            // NB: vanilla was checking for trees above the surface element.
+            // This has been omitted from our implementation.
+            auto* tree = element.as<TreeElement>();
+            if (tree != nullptr && !tree->isGhost())
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    static void rebuildTreeCounts()
+    {
+        _trees.build([](const TilePos2& pos) {
+            const auto count = countTileTrees(pos);
+            _treeCounts[(pos.y * kMapPitch) + pos.x] = count;
+            return count;
+        });
+        for (const auto index : _dirtyTreeTiles)
+        {
+            _isTreeCountDirty[index] = false;
+        }
+        _dirtyTreeTiles.clear();
+    }
+
+    static void updateDirtyTreeCounts()
+    {
+        for (const auto index : _dirtyTreeTiles)
+        {
+            const auto pos = TilePos2(static_cast<tile_coord_t>(index % kMapPitch), static_cast<tile_coord_t>(index / kMapPitch));
+            const auto count = countTileTrees(pos);
+            _trees.add(pos, count - _treeCounts[index]);
+            _treeCounts[index] = count;
+            _isTreeCountDirty[index] = false;
+        }
+        _dirtyTreeTiles.clear();
     }
 
     // 0x00461348
@@ -427,6 +751,11 @@ namespace OpenLoco::World::TileManager
         }
 
         _elementsEnd = el;
+        _numUsedElements = el - _elements;
+        resetBlocks();
+        invalidateAllTileCargo();
+        invalidateAllSurfaceCounts();
+        rebuildTreeCounts();
     }
 
     // 0x0046148F
@@ -477,7 +806,21 @@ namespace OpenLoco::World::TileManager
     // 0x00461393
     bool checkFreeElementsAndReorganise()
     {
-        return !(call(0x00461393) & Interop::X86_FLAG_CARRY);
+        // Only the end of the pool counts, free blocks might be too small for the tiles that grow.
+        // Packing moves every tile, so it can only be done here before a command uses any of them.
+        if (numTailElements() >= kReservedElements)
+        {
+            return true;
+        }
+
+        reorganise();
+        if (numTailElements() >= kReservedElements)
+        {
+            return true;
+        }
+
+        GameCommands::setErrorText(StringIds::too_many_objects_in_game);
+        return false;
     }
 
     // 0x00462926
@@ -720,101 +1063,159 @@ namespace OpenLoco::World::TileManager
         return highest - lowest;
     }
 
-    // 0x004C5596
-    uint16_t countSurroundingWaterTiles(const Pos2& pos)
+    static bool isWaterTile(const TilePos2& pos)
     {
-        // Search a 10x10 area centred at pos.
-        // Initial tile position is the top left of the area.
-        auto initialTilePos = World::TilePos2(pos) - World::TilePos2(5, 5);
+        auto* surface = get(pos).surface();
+        return surface != nullptr && surface->water() > 0;
+    }
 
-        uint16_t surroundingWaterTiles = 0;
-        for (uint8_t yOffset = 0; yOffset < 11; yOffset++)
+    static bool isDesertTile(const TilePos2& pos)
+    {
+        auto* surface = get(pos).surface();
+        // Desert tiles can't have water! Oasis aren't deserts.
+        if (surface == nullptr || surface->water() != 0)
         {
-            for (uint8_t xOffset = 0; xOffset < 11; xOffset++)
-            {
-                auto tilePos = initialTilePos + World::TilePos2(xOffset, yOffset);
-                if (!World::validCoords(tilePos))
-                    continue;
+            return false;
+        }
+        auto* landObj = ObjectManager::get<LandObject>(surface->terrain());
+        return landObj != nullptr && landObj->hasFlags(LandObjectFlags::isDesert);
+    }
 
-                auto tile = get(tilePos);
-                auto* surface = tile.surface();
-                if (surface != nullptr && surface->water() > 0)
-                    surroundingWaterTiles++;
+    template<typename TPred>
+    static uint16_t countSurroundingTiles(const Pos2& pos, TPred&& pred)
+    {
+        // Search an 11x11 area centred at pos.
+        const auto centre = World::TilePos2(pos);
+        uint16_t count = 0;
+        for (const auto& tilePos : TilePosRangeView(centre - World::TilePos2{ 5, 5 }, centre + World::TilePos2{ 5, 5 }))
+        {
+            if (World::validCoords(tilePos) && pred(tilePos))
+            {
+                count++;
             }
         }
+        return count;
+    }
 
-        return surroundingWaterTiles;
+    // Water and desert tiles of the map. Surfaces are changed in place, by our own code as well as
+    // the original game, so changed tiles are marked and counted again before the next query.
+    // Loading and commands of the original game mark the whole map.
+    constexpr uint8_t kWaterSurface = 1 << 0;
+    constexpr uint8_t kDesertSurface = 1 << 1;
+    static std::vector<uint8_t> _surfaceKinds(kMapPitch * kMapRows);
+    static std::vector<bool> _isSurfaceDirty(kMapPitch * kMapRows);
+    static std::vector<uint32_t> _dirtySurfaceTiles;
+    static bool _areAllSurfacesDirty = true;
+    static FenwickTree _waterTiles;
+    static FenwickTree _desertTiles;
+
+    static uint8_t getSurfaceKind(const TilePos2& pos)
+    {
+        return (isWaterTile(pos) ? kWaterSurface : 0) | (isDesertTile(pos) ? kDesertSurface : 0);
     }
 
-    // 0x00469B1D
-    uint16_t countSurroundingDesertTiles(const Pos2& pos)
+    void invalidateSurfaceCounts(const TilePos2& pos)
     {
-        // Search a 10x10 area centred at pos.
-        // Initial tile position is the top left of the area.
-        auto initialTilePos = World::TilePos2(pos) - World::TilePos2(5, 5);
+        const size_t index = (pos.y * kMapPitch) + pos.x;
+        if (!_areAllSurfacesDirty && !_isSurfaceDirty[index])
+        {
+            _isSurfaceDirty[index] = true;
+            _dirtySurfaceTiles.push_back(static_cast<uint32_t>(index));
+        }
+    }
 
-        uint16_t surroundingDesertTiles = 0;
+    void invalidateAllSurfaceCounts()
+    {
+        _areAllSurfacesDirty = true;
+        for (const auto index : _dirtySurfaceTiles)
+        {
+            _isSurfaceDirty[index] = false;
+        }
+        _dirtySurfaceTiles.clear();
+    }
 
-        for (const auto& tilePos : TilePosRangeView(initialTilePos, initialTilePos + World::TilePos2{ 10, 10 }))
+    static void updateSurfaceCounts()
+    {
+        if (_areAllSurfacesDirty)
         {
-            if (!World::validCoords(tilePos))
-                continue;
+            _waterTiles.build([](const TilePos2& pos) {
+                const auto kind = getSurfaceKind(pos);
+                _surfaceKinds[(pos.y * kMapPitch) + pos.x] = kind;
+                return (kind & kWaterSurface) != 0 ? 1 : 0;
+            });
+            _desertTiles.build([](const TilePos2& pos) {
+                return (_surfaceKinds[(pos.y * kMapPitch) + pos.x] & kDesertSurface) != 0 ? 1 : 0;
+            });
+            _areAllSurfacesDirty = false;
+            return;
+        }
 
-            auto tile = get(tilePos);
-            auto* surface = tile.surface();
-            // Desert tiles can't have water! Oasis aren't deserts.
-            if (surface == nullptr || surface->water() != 0)
-            {
-                continue;
-            }
-            auto* landObj = ObjectManager::get<LandObject>(surface->terrain());
-            if (landObj == nullptr)
+        for (const auto index : _dirtySurfaceTiles)
+        {
+            const auto pos = TilePos2(static_cast<tile_coord_t>(index % kMapPitch), static_cast<tile_coord_t>(index / kMapPitch));
+            const auto kind = getSurfaceKind(pos);
+            const auto changed = kind ^ _surfaceKinds[index];
+            if ((changed & kWaterSurface) != 0)
             {
-                continue;
+                _waterTiles.add(pos, (kind & kWaterSurface) != 0 ? 1 : -1);
             }
-            if (landObj->hasFlags(LandObjectFlags::isDesert))
+            if ((changed & kDesertSurface) != 0)
             {
-                surroundingDesertTiles++;
+                _desertTiles.add(pos, (kind & kDesertSurface) != 0 ? 1 : -1);
             }
+            _surfaceKinds[index] = kind;
+            _isSurfaceDirty[index] = false;
         }
+        _dirtySurfaceTiles.clear();
+    }
+
+    template<typename TPred>
+    static uint16_t countSurroundingTiles(const FenwickTree& tiles, const Pos2& pos, TPred&& pred)
+    {
+        updateSurfaceCounts();
+        const auto centre = World::TilePos2(pos);
+        const auto count = static_cast<uint16_t>(tiles.sum(centre - World::TilePos2{ 5, 5 }, centre + World::TilePos2{ 5, 5 }));
+#if DEBUG
+        // A surface has been changed without marking it if this does not match
+        assert(count == countSurroundingTiles(pos, pred));
+#else
+        (void)pred;
+#endif
+        return count;
+    }
 
-        return surroundingDesertTiles;
+    // 0x004C5596
+    uint16_t countSurroundingWaterTiles(const Pos2& pos)
+    {
+        return countSurroundingTiles(_waterTiles, pos, isWaterTile);
+    }
+
+    // 0x00469B1D
+    uint16_t countSurroundingDesertTiles(const Pos2& pos)
+    {
+        return countSurroundingTiles(_desertTiles, pos, isDesertTile);
     }
 
     // 0x004BE048
     uint16_t countSurroundingTrees(const Pos2& pos)
     {
-        // Search a 10x10 area centred at pos.
-        // Initial tile position is the top left of the area.
-        auto initialTilePos = World::TilePos2(pos) - World::TilePos2(5, 5);
-
+        // Search an 11x11 area centred at pos.
+        updateDirtyTreeCounts();
+        const auto centre = World::TilePos2(pos);
+        const auto count = static_cast<uint16_t>(_trees.sum(centre - World::TilePos2{ 5, 5 }, centre + World::TilePos2{ 5, 5 }));
+#if DEBUG
+        // A tree has been changed without inserting or removing an element if this does not match
         uint16_t surroundingTrees = 0;
-        for (uint8_t yOffset = 0; yOffset < 11; yOffset++)
+        for (const auto& tilePos : TilePosRangeView(centre - World::TilePos2{ 5, 5 }, centre + World::TilePos2{ 5, 5 }))
         {
-            for (uint8_t xOffset = 0; xOffset < 11; xOffset++)
+            if (World::validCoords(tilePos))
             {
-                auto tilePos = initialTilePos + World::TilePos2(xOffset, yOffset);
-                if (!World::validCoords(tilePos))
-                    continue;
-
-                auto tile = get(tilePos);
-                for (auto& element : tile)
-                {
-                    // NB: vanilla was checking for trees above the surface element.
-                    // This has been omitted from our implementation.
-                    auto* tree = element.as<TreeElement>();
-                    if (tree == nullptr)
-                        continue;
-
-                    if (tree->isGhost())
-                        continue;
-
-                    surroundingTrees++;
-                }
+                surroundingTrees += countTileTrees(tilePos);
             }
         }
-
-        return surroundingTrees;
+        assert(count == surroundingTrees);
+#endif
+        return count;
     }
 
     static bool update(TileElement& el, const World::Pos2& loc)
@@ -999,11 +1400,72 @@ namespace OpenLoco::World::TileManager
                 return 0;
             });
 
+        registerHook(
+            0x00469B1D,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                regs.dx = countSurroundingDesertTiles({ regs.ax, regs.cx });
+                return 0;
+            });
+
         registerHook(
             0x0046902E,
             [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
                 removeSurfaceIndustry({ regs.ax, regs.cx });
                 return 0;
             });
+
+        // The original game has to use the same element allocator
+        registerHook(
+            0x00461348,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                updateTilePointers();
+                regs = backup;
+                return 0;
+            });
+
+        registerHook(
+            0x0046148F,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                reorganise();
+                regs = backup;
+                return 0;
+            });
+
+        registerHook(
+            0x00461393,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                const auto hasFreeElements = checkFreeElementsAndReorganise();
+                regs = backup;
+                return hasFreeElements ? 0 : X86_FLAG_CARRY;
+            });
+
+        registerHook(
+            0x004616D6,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                // Callers of the original game set the type themselves
+                const auto pos = Pos2(regs.ax, regs.cx);
+                auto* element = insertElement(ElementType::surface, pos, regs.bl, regs.bh);
+                if (element != nullptr)
+                {
+                    invalidateTileCargo(TilePos2(pos));
+                    markTreeCountDirty(TilePos2(pos));
+                }
+                regs = backup;
+                regs.esi = X86Pointer(element);
+                return 0;
+            });
+
+        registerHook(
+            0x00461760,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                removeElement(*X86Pointer<TileElement>(regs.esi));
+                regs = backup;
+                return 0;
+            });
     }
 }
@@ -50,6 +50,10 @@ namespace OpenLoco::World::TileManager
     uint8_t getMapSelectionCorner();
     void resetSurfaceClearance();
     int16_t mountainHeight(const World::Pos2& loc);
+
+    // Marks surfaces whose water or terrain has been changed, so they are counted again
+    void invalidateSurfaceCounts(const TilePos2& pos);
+    void invalidateAllSurfaceCounts();
     uint16_t countSurroundingWaterTiles(const Pos2& pos);
     uint16_t countSurroundingDesertTiles(const Pos2& pos);
     uint16_t countSurroundingTrees(const Pos2& pos);
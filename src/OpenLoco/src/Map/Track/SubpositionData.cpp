@@ -11,7 +11,7 @@ namespace OpenLoco::World::TrackData
 #pragma region TrackData
     // 0x4da526
     // Track 0. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT0R0D0 = {
+    static constexpr MoveInfo moveInfoT0R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -48,7 +48,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4da628
     // Track 0. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT0R0D1 = {
+    static constexpr MoveInfo moveInfoT0R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -85,7 +85,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4da72a
     // Track 0. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT0R0D2 = {
+    static constexpr MoveInfo moveInfoT0R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -122,7 +122,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4da82c
     // Track 0. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT0R0D3 = {
+    static constexpr MoveInfo moveInfoT0R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -159,7 +159,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc14e
     // Track 1. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT1R0D0 = {
+    static constexpr MoveInfo moveInfoT1R0D0[] = {
         { { 15, 16, 0 }, 8, Pitch::flat },
         { { 14, 17, 0 }, 8, Pitch::flat },
         { { 13, 18, 0 }, 8, Pitch::flat },
@@ -196,7 +196,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc250
     // Track 1. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT1R0D1 = {
+    static constexpr MoveInfo moveInfoT1R0D1[] = {
         { { 16, 16, 0 }, 24, Pitch::flat },
         { { 17, 17, 0 }, 24, Pitch::flat },
         { { 18, 18, 0 }, 24, Pitch::flat },
@@ -233,7 +233,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc352
     // Track 1. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT1R0D2 = {
+    static constexpr MoveInfo moveInfoT1R0D2[] = {
         { { 16, 15, 0 }, 40, Pitch::flat },
         { { 17, 14, 0 }, 40, Pitch::flat },
         { { 18, 13, 0 }, 40, Pitch::flat },
@@ -270,7 +270,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc454
     // Track 1. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT1R0D3 = {
+    static constexpr MoveInfo moveInfoT1R0D3[] = {
         { { 15, 15, 0 }, 56, Pitch::flat },
         { { 14, 14, 0 }, 56, Pitch::flat },
         { { 13, 13, 0 }, 56, Pitch::flat },
@@ -307,7 +307,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df376
     // Track 2. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT2R0D0 = {
+    static constexpr MoveInfo moveInfoT2R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 62, Pitch::flat },
@@ -334,7 +334,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df428
     // Track 2. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT2R0D1 = {
+    static constexpr MoveInfo moveInfoT2R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -362,7 +362,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df4e2
     // Track 2. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT2R0D2 = {
+    static constexpr MoveInfo moveInfoT2R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -389,7 +389,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df594
     // Track 2. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT2R0D3 = {
+    static constexpr MoveInfo moveInfoT2R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 46, Pitch::flat },
@@ -415,7 +415,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df6e8
     // Track 2. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT2R1D0 = {
+    static constexpr MoveInfo moveInfoT2R1D0[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -442,7 +442,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df79a
     // Track 2. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT2R1D1 = {
+    static constexpr MoveInfo moveInfoT2R1D1[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -470,7 +470,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df854
     // Track 2. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT2R1D2 = {
+    static constexpr MoveInfo moveInfoT2R1D2[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 50, Pitch::flat },
@@ -497,7 +497,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df63e
     // Track 2. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT2R1D3 = {
+    static constexpr MoveInfo moveInfoT2R1D3[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 2, Pitch::flat },
@@ -523,7 +523,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df906
     // Track 4. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT4R0D0 = {
+    static constexpr MoveInfo moveInfoT4R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -596,7 +596,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dfb28
     // Track 4. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT4R0D1 = {
+    static constexpr MoveInfo moveInfoT4R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -670,7 +670,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dfd52
     // Track 4. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT4R0D2 = {
+    static constexpr MoveInfo moveInfoT4R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -743,7 +743,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dff74
     // Track 4. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT4R0D3 = {
+    static constexpr MoveInfo moveInfoT4R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -815,7 +815,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e03a8
     // Track 4. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT4R1D0 = {
+    static constexpr MoveInfo moveInfoT4R1D0[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -888,7 +888,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e05ca
     // Track 4. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT4R1D1 = {
+    static constexpr MoveInfo moveInfoT4R1D1[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -962,7 +962,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e07f4
     // Track 4. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT4R1D2 = {
+    static constexpr MoveInfo moveInfoT4R1D2[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -1035,7 +1035,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e018e
     // Track 4. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT4R1D3 = {
+    static constexpr MoveInfo moveInfoT4R1D3[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -1107,7 +1107,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e0a16
     // Track 6. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT6R0D0 = {
+    static constexpr MoveInfo moveInfoT6R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -1226,7 +1226,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e0da8
     // Track 6. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT6R0D1 = {
+    static constexpr MoveInfo moveInfoT6R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -1346,7 +1346,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e1142
     // Track 6. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT6R0D2 = {
+    static constexpr MoveInfo moveInfoT6R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -1465,7 +1465,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e14d4
     // Track 6. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT6R0D3 = {
+    static constexpr MoveInfo moveInfoT6R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -1583,7 +1583,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e1be8
     // Track 6. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT6R1D0 = {
+    static constexpr MoveInfo moveInfoT6R1D0[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -1702,7 +1702,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e1f7a
     // Track 6. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT6R1D1 = {
+    static constexpr MoveInfo moveInfoT6R1D1[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -1822,7 +1822,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e2314
     // Track 6. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT6R1D2 = {
+    static constexpr MoveInfo moveInfoT6R1D2[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -1941,7 +1941,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e185e
     // Track 6. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT6R1D3 = {
+    static constexpr MoveInfo moveInfoT6R1D3[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -2059,7 +2059,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e26a6
     // Track 8. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT8R0D0 = {
+    static constexpr MoveInfo moveInfoT8R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -2143,7 +2143,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e2920
     // Track 8. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT8R0D1 = {
+    static constexpr MoveInfo moveInfoT8R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -2228,7 +2228,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e2ba2
     // Track 8. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT8R0D2 = {
+    static constexpr MoveInfo moveInfoT8R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -2313,7 +2313,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e2e24
     // Track 8. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT8R0D3 = {
+    static constexpr MoveInfo moveInfoT8R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -2398,7 +2398,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e4728
     // Track 8. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT8R1D0 = {
+    static constexpr MoveInfo moveInfoT8R1D0[] = {
         { { 16, 16, 0 }, 24, Pitch::flat },
         { { 17, 17, 0 }, 24, Pitch::flat },
         { { 18, 18, 0 }, 24, Pitch::flat },
@@ -2483,7 +2483,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e49aa
     // Track 8. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT8R1D1 = {
+    static constexpr MoveInfo moveInfoT8R1D1[] = {
         { { 16, 15, 0 }, 40, Pitch::flat },
         { { 17, 14, 0 }, 40, Pitch::flat },
         { { 18, 13, 0 }, 40, Pitch::flat },
@@ -2568,7 +2568,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e4c2c
     // Track 8. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT8R1D2 = {
+    static constexpr MoveInfo moveInfoT8R1D2[] = {
         { { 15, 15, 0 }, 56, Pitch::flat },
         { { 14, 14, 0 }, 56, Pitch::flat },
         { { 13, 13, 0 }, 56, Pitch::flat },
@@ -2653,7 +2653,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e44ae
     // Track 8. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT8R1D3 = {
+    static constexpr MoveInfo moveInfoT8R1D3[] = {
         { { 15, 17, 0 }, 8, Pitch::flat },
         { { 14, 18, 0 }, 8, Pitch::flat },
         { { 13, 19, 0 }, 8, Pitch::flat },
@@ -2737,7 +2737,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e3aa6
     // Track 9. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT9R0D0 = {
+    static constexpr MoveInfo moveInfoT9R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -2822,7 +2822,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e3d28
     // Track 9. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT9R0D1 = {
+    static constexpr MoveInfo moveInfoT9R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -2907,7 +2907,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e3faa
     // Track 9. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT9R0D2 = {
+    static constexpr MoveInfo moveInfoT9R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -2992,7 +2992,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e422c
     // Track 9. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT9R0D3 = {
+    static constexpr MoveInfo moveInfoT9R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -3077,7 +3077,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e35a2
     // Track 9. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT9R1D0 = {
+    static constexpr MoveInfo moveInfoT9R1D0[] = {
         { { 16, 15, 0 }, 40, Pitch::flat },
         { { 17, 14, 0 }, 40, Pitch::flat },
         { { 18, 13, 0 }, 40, Pitch::flat },
@@ -3162,7 +3162,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e3824
     // Track 9. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT9R1D1 = {
+    static constexpr MoveInfo moveInfoT9R1D1[] = {
         { { 15, 15, 0 }, 56, Pitch::flat },
         { { 14, 14, 0 }, 56, Pitch::flat },
         { { 13, 13, 0 }, 56, Pitch::flat },
@@ -3247,7 +3247,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e30a6
     // Track 9. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT9R1D2 = {
+    static constexpr MoveInfo moveInfoT9R1D2[] = {
         { { 15, 17, 0 }, 8, Pitch::flat },
         { { 14, 18, 0 }, 8, Pitch::flat },
         { { 13, 19, 0 }, 8, Pitch::flat },
@@ -3331,7 +3331,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e3320
     // Track 9. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT9R1D3 = {
+    static constexpr MoveInfo moveInfoT9R1D3[] = {
         { { 16, 16, 0 }, 24, Pitch::flat },
         { { 17, 17, 0 }, 24, Pitch::flat },
         { { 18, 18, 0 }, 24, Pitch::flat },
@@ -3416,7 +3416,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e4eae
     // Track 12. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT12R0D0 = {
+    static constexpr MoveInfo moveInfoT12R0D0[] = {
         { { 32, 16, 0 }, 0, Pitch::flat },
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
@@ -3517,7 +3517,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e51b0
     // Track 12. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT12R0D1 = {
+    static constexpr MoveInfo moveInfoT12R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -3618,7 +3618,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e54b2
     // Track 12. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT12R0D2 = {
+    static constexpr MoveInfo moveInfoT12R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -3719,7 +3719,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e57b4
     // Track 12. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT12R0D3 = {
+    static constexpr MoveInfo moveInfoT12R0D3[] = {
         { { 16, 32, 0 }, 48, Pitch::flat },
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
@@ -3820,7 +3820,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e5ab6
     // Track 13. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT13R0D0 = {
+    static constexpr MoveInfo moveInfoT13R0D0[] = {
         { { 32, 16, 0 }, 0, Pitch::flat },
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
@@ -3921,7 +3921,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e5db8
     // Track 13. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT13R0D1 = {
+    static constexpr MoveInfo moveInfoT13R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -4022,7 +4022,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e60ba
     // Track 13. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT13R0D2 = {
+    static constexpr MoveInfo moveInfoT13R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -4123,7 +4123,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e63bc
     // Track 13. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT13R0D3 = {
+    static constexpr MoveInfo moveInfoT13R0D3[] = {
         { { 16, 32, 0 }, 48, Pitch::flat },
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
@@ -4224,7 +4224,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4da92e
     // Track 14. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT14R0D0 = {
+    static constexpr MoveInfo moveInfoT14R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::up12deg },
         { { 30, 16, 0 }, 0, Pitch::up12deg },
         { { 29, 16, 0 }, 0, Pitch::up12deg },
@@ -4293,7 +4293,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dab30
     // Track 14. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT14R0D1 = {
+    static constexpr MoveInfo moveInfoT14R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::up12deg },
         { { 16, 1, 0 }, 16, Pitch::up12deg },
         { { 16, 2, 0 }, 16, Pitch::up12deg },
@@ -4362,7 +4362,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dad32
     // Track 14. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT14R0D2 = {
+    static constexpr MoveInfo moveInfoT14R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::up12deg },
         { { 1, 16, 0 }, 32, Pitch::up12deg },
         { { 2, 16, 0 }, 32, Pitch::up12deg },
@@ -4431,7 +4431,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4daf34
     // Track 14. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT14R0D3 = {
+    static constexpr MoveInfo moveInfoT14R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::up12deg },
         { { 16, 30, 0 }, 48, Pitch::up12deg },
         { { 16, 29, 0 }, 48, Pitch::up12deg },
@@ -4500,7 +4500,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4db53a
     // Track 14. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT14R1D0 = {
+    static constexpr MoveInfo moveInfoT14R1D0[] = {
         { { 0, 16, 0 }, 32, Pitch::down12deg },
         { { 1, 16, 0 }, 32, Pitch::down12deg },
         { { 2, 16, 0 }, 32, Pitch::down12deg },
@@ -4569,7 +4569,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4db73c
     // Track 14. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT14R1D1 = {
+    static constexpr MoveInfo moveInfoT14R1D1[] = {
         { { 16, 31, 0 }, 48, Pitch::down12deg },
         { { 16, 30, 0 }, 48, Pitch::down12deg },
         { { 16, 29, 0 }, 48, Pitch::down12deg },
@@ -4638,7 +4638,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4db136
     // Track 14. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT14R1D2 = {
+    static constexpr MoveInfo moveInfoT14R1D2[] = {
         { { 31, 16, 0 }, 0, Pitch::down12deg },
         { { 30, 16, 0 }, 0, Pitch::down12deg },
         { { 29, 16, 0 }, 0, Pitch::down12deg },
@@ -4707,7 +4707,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4db338
     // Track 14. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT14R1D3 = {
+    static constexpr MoveInfo moveInfoT14R1D3[] = {
         { { 16, 0, 0 }, 16, Pitch::down12deg },
         { { 16, 1, 0 }, 16, Pitch::down12deg },
         { { 16, 2, 0 }, 16, Pitch::down12deg },
@@ -4776,7 +4776,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4db93e
     // Track 16. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT16R0D0 = {
+    static constexpr MoveInfo moveInfoT16R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::up25deg },
         { { 30, 16, 0 }, 0, Pitch::up25deg },
         { { 29, 16, 1 }, 0, Pitch::up25deg },
@@ -4813,7 +4813,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dba40
     // Track 16. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT16R0D1 = {
+    static constexpr MoveInfo moveInfoT16R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::up25deg },
         { { 16, 1, 0 }, 16, Pitch::up25deg },
         { { 16, 2, 1 }, 16, Pitch::up25deg },
@@ -4850,7 +4850,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dbb42
     // Track 16. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT16R0D2 = {
+    static constexpr MoveInfo moveInfoT16R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::up25deg },
         { { 1, 16, 0 }, 32, Pitch::up25deg },
         { { 2, 16, 1 }, 32, Pitch::up25deg },
@@ -4887,7 +4887,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dbc44
     // Track 16. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT16R0D3 = {
+    static constexpr MoveInfo moveInfoT16R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::up25deg },
         { { 16, 30, 0 }, 48, Pitch::up25deg },
         { { 16, 29, 1 }, 48, Pitch::up25deg },
@@ -4924,7 +4924,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dbf4a
     // Track 16. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT16R1D0 = {
+    static constexpr MoveInfo moveInfoT16R1D0[] = {
         { { 0, 16, 0 }, 32, Pitch::down25deg },
         { { 1, 16, 0 }, 32, Pitch::down25deg },
         { { 2, 16, -1 }, 32, Pitch::down25deg },
@@ -4961,7 +4961,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc04c
     // Track 16. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT16R1D1 = {
+    static constexpr MoveInfo moveInfoT16R1D1[] = {
         { { 16, 31, 0 }, 48, Pitch::down25deg },
         { { 16, 30, 0 }, 48, Pitch::down25deg },
         { { 16, 29, -1 }, 48, Pitch::down25deg },
@@ -4998,7 +4998,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dbd46
     // Track 16. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT16R1D2 = {
+    static constexpr MoveInfo moveInfoT16R1D2[] = {
         { { 31, 16, 0 }, 0, Pitch::down25deg },
         { { 30, 16, 0 }, 0, Pitch::down25deg },
         { { 29, 16, -1 }, 0, Pitch::down25deg },
@@ -5035,7 +5035,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dbe48
     // Track 16. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT16R1D3 = {
+    static constexpr MoveInfo moveInfoT16R1D3[] = {
         { { 16, 0, 0 }, 16, Pitch::down25deg },
         { { 16, 1, 0 }, 16, Pitch::down25deg },
         { { 16, 2, -1 }, 16, Pitch::down25deg },
@@ -5072,7 +5072,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e66be
     // Track 18. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT18R0D0 = {
+    static constexpr MoveInfo moveInfoT18R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::up10deg },
         { { 30, 16, 0 }, 0, Pitch::up10deg },
         { { 29, 16, 0 }, 0, Pitch::up10deg },
@@ -5145,7 +5145,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e68e0
     // Track 18. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT18R0D1 = {
+    static constexpr MoveInfo moveInfoT18R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::up10deg },
         { { 16, 1, 0 }, 16, Pitch::up10deg },
         { { 16, 2, 0 }, 16, Pitch::up10deg },
@@ -5219,7 +5219,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e6b0a
     // Track 18. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT18R0D2 = {
+    static constexpr MoveInfo moveInfoT18R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::up10deg },
         { { 1, 16, 0 }, 32, Pitch::up10deg },
         { { 2, 16, 0 }, 32, Pitch::up10deg },
@@ -5292,7 +5292,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e6d2c
     // Track 18. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT18R0D3 = {
+    static constexpr MoveInfo moveInfoT18R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::up10deg },
         { { 16, 30, 0 }, 48, Pitch::up10deg },
         { { 16, 29, 0 }, 48, Pitch::up10deg },
@@ -5364,7 +5364,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e8270
     // Track 18. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT18R1D0 = {
+    static constexpr MoveInfo moveInfoT18R1D0[] = {
         { { 16, 0, 0 }, 16, Pitch::down10deg },
         { { 16, 1, 0 }, 16, Pitch::down10deg },
         { { 16, 2, 0 }, 16, Pitch::down10deg },
@@ -5437,7 +5437,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e8492
     // Track 18. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT18R1D1 = {
+    static constexpr MoveInfo moveInfoT18R1D1[] = {
         { { 0, 16, 0 }, 32, Pitch::down10deg },
         { { 1, 16, 0 }, 32, Pitch::down10deg },
         { { 2, 16, 0 }, 32, Pitch::down10deg },
@@ -5511,7 +5511,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e86bc
     // Track 18. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT18R1D2 = {
+    static constexpr MoveInfo moveInfoT18R1D2[] = {
         { { 16, 31, 0 }, 48, Pitch::down10deg },
         { { 16, 30, 0 }, 48, Pitch::down10deg },
         { { 16, 29, 0 }, 48, Pitch::down10deg },
@@ -5584,7 +5584,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e8056
     // Track 18. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT18R1D3 = {
+    static constexpr MoveInfo moveInfoT18R1D3[] = {
         { { 31, 16, 0 }, 0, Pitch::down10deg },
         { { 30, 16, 0 }, 0, Pitch::down10deg },
         { { 29, 16, 0 }, 0, Pitch::down10deg },
@@ -5656,7 +5656,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e6f46
     // Track 19. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT19R0D0 = {
+    static constexpr MoveInfo moveInfoT19R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::up10deg },
         { { 30, 16, 0 }, 0, Pitch::up10deg },
         { { 29, 16, 0 }, 0, Pitch::up10deg },
@@ -5728,7 +5728,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e7160
     // Track 19. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT19R0D1 = {
+    static constexpr MoveInfo moveInfoT19R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::up10deg },
         { { 16, 1, 0 }, 16, Pitch::up10deg },
         { { 16, 2, 0 }, 16, Pitch::up10deg },
@@ -5801,7 +5801,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e7382
     // Track 19. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT19R0D2 = {
+    static constexpr MoveInfo moveInfoT19R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::up10deg },
         { { 1, 16, 0 }, 32, Pitch::up10deg },
         { { 2, 16, 0 }, 32, Pitch::up10deg },
@@ -5875,7 +5875,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e75ac
     // Track 19. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT19R0D3 = {
+    static constexpr MoveInfo moveInfoT19R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::up10deg },
         { { 16, 30, 0 }, 48, Pitch::up10deg },
         { { 16, 29, 0 }, 48, Pitch::up10deg },
@@ -5948,7 +5948,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e7e3c
     // Track 19. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT19R1D0 = {
+    static constexpr MoveInfo moveInfoT19R1D0[] = {
         { { 16, 31, 0 }, 48, Pitch::down10deg },
         { { 16, 30, 0 }, 48, Pitch::down10deg },
         { { 16, 29, 0 }, 48, Pitch::down10deg },
@@ -6020,7 +6020,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e77ce
     // Track 19. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT19R1D1 = {
+    static constexpr MoveInfo moveInfoT19R1D1[] = {
         { { 31, 16, 0 }, 0, Pitch::down10deg },
         { { 30, 16, 0 }, 0, Pitch::down10deg },
         { { 29, 16, 0 }, 0, Pitch::down10deg },
@@ -6093,7 +6093,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e79f0
     // Track 19. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT19R1D2 = {
+    static constexpr MoveInfo moveInfoT19R1D2[] = {
         { { 16, 0, 0 }, 16, Pitch::down10deg },
         { { 16, 1, 0 }, 16, Pitch::down10deg },
         { { 16, 2, 0 }, 16, Pitch::down10deg },
@@ -6167,7 +6167,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e7c1a
     // Track 19. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT19R1D3 = {
+    static constexpr MoveInfo moveInfoT19R1D3[] = {
         { { 0, 16, 0 }, 32, Pitch::down10deg },
         { { 1, 16, 0 }, 32, Pitch::down10deg },
         { { 2, 16, 0 }, 32, Pitch::down10deg },
@@ -6240,7 +6240,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e88de
     // Track 22. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT22R0D0 = {
+    static constexpr MoveInfo moveInfoT22R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::up20deg },
         { { 30, 16, 0 }, 0, Pitch::up20deg },
         { { 29, 16, 1 }, 0, Pitch::up20deg },
@@ -6313,7 +6313,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e8b00
     // Track 22. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT22R0D1 = {
+    static constexpr MoveInfo moveInfoT22R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::up20deg },
         { { 16, 1, 0 }, 16, Pitch::up20deg },
         { { 16, 2, 0 }, 16, Pitch::up20deg },
@@ -6387,7 +6387,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e8d2a
     // Track 22. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT22R0D2 = {
+    static constexpr MoveInfo moveInfoT22R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::up20deg },
         { { 1, 16, 0 }, 32, Pitch::up20deg },
         { { 2, 16, 0 }, 32, Pitch::up20deg },
@@ -6460,7 +6460,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e8f4c
     // Track 22. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT22R0D3 = {
+    static constexpr MoveInfo moveInfoT22R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::up20deg },
         { { 16, 30, 0 }, 48, Pitch::up20deg },
         { { 16, 29, 1 }, 48, Pitch::up20deg },
@@ -6532,7 +6532,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ea490
     // Track 22. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT22R1D0 = {
+    static constexpr MoveInfo moveInfoT22R1D0[] = {
         { { 16, 0, 0 }, 16, Pitch::down20deg },
         { { 16, 1, 0 }, 16, Pitch::down20deg },
         { { 16, 2, 0 }, 16, Pitch::down20deg },
@@ -6605,7 +6605,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ea6b2
     // Track 22. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT22R1D1 = {
+    static constexpr MoveInfo moveInfoT22R1D1[] = {
         { { 0, 16, 0 }, 32, Pitch::down20deg },
         { { 1, 16, 0 }, 32, Pitch::down20deg },
         { { 2, 16, 0 }, 32, Pitch::down20deg },
@@ -6679,7 +6679,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ea8dc
     // Track 22. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT22R1D2 = {
+    static constexpr MoveInfo moveInfoT22R1D2[] = {
         { { 16, 31, 0 }, 48, Pitch::down20deg },
         { { 16, 30, 0 }, 48, Pitch::down20deg },
         { { 16, 29, -1 }, 48, Pitch::down20deg },
@@ -6752,7 +6752,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ea276
     // Track 22. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT22R1D3 = {
+    static constexpr MoveInfo moveInfoT22R1D3[] = {
         { { 31, 16, 0 }, 0, Pitch::down20deg },
         { { 30, 16, 0 }, 0, Pitch::down20deg },
         { { 29, 16, -1 }, 0, Pitch::down20deg },
@@ -6824,7 +6824,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e9166
     // Track 23. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT23R0D0 = {
+    static constexpr MoveInfo moveInfoT23R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::up20deg },
         { { 30, 16, 0 }, 0, Pitch::up20deg },
         { { 29, 16, 1 }, 0, Pitch::up20deg },
@@ -6896,7 +6896,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e9380
     // Track 23. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT23R0D1 = {
+    static constexpr MoveInfo moveInfoT23R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::up20deg },
         { { 16, 1, 0 }, 16, Pitch::up20deg },
         { { 16, 2, 0 }, 16, Pitch::up20deg },
@@ -6969,7 +6969,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e95a2
     // Track 23. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT23R0D2 = {
+    static constexpr MoveInfo moveInfoT23R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::up20deg },
         { { 1, 16, 0 }, 32, Pitch::up20deg },
         { { 2, 16, 0 }, 32, Pitch::up20deg },
@@ -7043,7 +7043,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e97cc
     // Track 23. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT23R0D3 = {
+    static constexpr MoveInfo moveInfoT23R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::up20deg },
         { { 16, 30, 0 }, 48, Pitch::up20deg },
         { { 16, 29, 1 }, 48, Pitch::up20deg },
@@ -7116,7 +7116,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ea05c
     // Track 23. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT23R1D0 = {
+    static constexpr MoveInfo moveInfoT23R1D0[] = {
         { { 16, 31, 0 }, 48, Pitch::down20deg },
         { { 16, 30, 0 }, 48, Pitch::down20deg },
         { { 16, 29, -1 }, 48, Pitch::down20deg },
@@ -7188,7 +7188,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e99ee
     // Track 23. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT23R1D1 = {
+    static constexpr MoveInfo moveInfoT23R1D1[] = {
         { { 31, 16, 0 }, 0, Pitch::down20deg },
         { { 30, 16, 0 }, 0, Pitch::down20deg },
         { { 29, 16, -1 }, 0, Pitch::down20deg },
@@ -7261,7 +7261,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e9c10
     // Track 23. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT23R1D2 = {
+    static constexpr MoveInfo moveInfoT23R1D2[] = {
         { { 16, 0, 0 }, 16, Pitch::down20deg },
         { { 16, 1, 0 }, 16, Pitch::down20deg },
         { { 16, 2, 0 }, 16, Pitch::down20deg },
@@ -7335,7 +7335,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4e9e3a
     // Track 23. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT23R1D3 = {
+    static constexpr MoveInfo moveInfoT23R1D3[] = {
         { { 0, 16, 0 }, 32, Pitch::down20deg },
         { { 1, 16, 0 }, 32, Pitch::down20deg },
         { { 2, 16, 0 }, 32, Pitch::down20deg },
@@ -7408,7 +7408,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc556
     // Track 26. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT26R0D0 = {
+    static constexpr MoveInfo moveInfoT26R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -7445,7 +7445,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc658
     // Track 26. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT26R0D1 = {
+    static constexpr MoveInfo moveInfoT26R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -7482,7 +7482,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc75a
     // Track 26. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT26R0D2 = {
+    static constexpr MoveInfo moveInfoT26R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -7519,7 +7519,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc85c
     // Track 26. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT26R0D3 = {
+    static constexpr MoveInfo moveInfoT26R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -7556,7 +7556,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcb62
     // Track 26. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT26R1D0 = {
+    static constexpr MoveInfo moveInfoT26R1D0[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -7593,7 +7593,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcc64
     // Track 26. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT26R1D1 = {
+    static constexpr MoveInfo moveInfoT26R1D1[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -7630,7 +7630,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc95e
     // Track 26. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT26R1D2 = {
+    static constexpr MoveInfo moveInfoT26R1D2[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -7667,7 +7667,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dca60
     // Track 26. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT26R1D3 = {
+    static constexpr MoveInfo moveInfoT26R1D3[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -7704,7 +7704,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eaafe
     // Track 28. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT28R0D0 = {
+    static constexpr MoveInfo moveInfoT28R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 62, Pitch::flat },
@@ -7721,7 +7721,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eab60
     // Track 28. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT28R0D1 = {
+    static constexpr MoveInfo moveInfoT28R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 14, Pitch::flat },
@@ -7738,7 +7738,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eabc2
     // Track 28. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT28R0D2 = {
+    static constexpr MoveInfo moveInfoT28R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -7755,7 +7755,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eac24
     // Track 28. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT28R0D3 = {
+    static constexpr MoveInfo moveInfoT28R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 46, Pitch::flat },
@@ -7771,7 +7771,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb0c6
     // Track 28. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT28R1D0 = {
+    static constexpr MoveInfo moveInfoT28R1D0[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -7788,7 +7788,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb128
     // Track 28. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT28R1D1 = {
+    static constexpr MoveInfo moveInfoT28R1D1[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 34, Pitch::flat },
@@ -7805,7 +7805,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb18a
     // Track 28. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT28R1D2 = {
+    static constexpr MoveInfo moveInfoT28R1D2[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 50, Pitch::flat },
@@ -7822,7 +7822,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb1ec
     // Track 28. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT28R1D3 = {
+    static constexpr MoveInfo moveInfoT28R1D3[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 2, Pitch::flat },
@@ -7838,7 +7838,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb350
     // Track 29. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT29R0D0 = {
+    static constexpr MoveInfo moveInfoT29R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -7877,7 +7877,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb462
     // Track 29. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT29R0D1 = {
+    static constexpr MoveInfo moveInfoT29R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -7917,7 +7917,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb57c
     // Track 29. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT29R0D2 = {
+    static constexpr MoveInfo moveInfoT29R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -7956,7 +7956,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb246
     // Track 29. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT29R0D3 = {
+    static constexpr MoveInfo moveInfoT29R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -7994,7 +7994,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ead88
     // Track 29. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT29R1D0 = {
+    static constexpr MoveInfo moveInfoT29R1D0[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -8033,7 +8033,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eae9a
     // Track 29. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT29R1D1 = {
+    static constexpr MoveInfo moveInfoT29R1D1[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -8073,7 +8073,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eafb4
     // Track 29. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT29R1D2 = {
+    static constexpr MoveInfo moveInfoT29R1D2[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -8112,7 +8112,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eac7e
     // Track 29. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT29R1D3 = {
+    static constexpr MoveInfo moveInfoT29R1D3[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -8150,7 +8150,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb68e
     // Track 32. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT32R0D0 = {
+    static constexpr MoveInfo moveInfoT32R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -8187,7 +8187,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb790
     // Track 32. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT32R0D1 = {
+    static constexpr MoveInfo moveInfoT32R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -8224,7 +8224,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb892
     // Track 32. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT32R0D2 = {
+    static constexpr MoveInfo moveInfoT32R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -8261,7 +8261,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb994
     // Track 32. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT32R0D3 = {
+    static constexpr MoveInfo moveInfoT32R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -8298,7 +8298,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eba96
     // Track 33. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT33R0D0 = {
+    static constexpr MoveInfo moveInfoT33R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -8335,7 +8335,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ebb98
     // Track 33. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT33R0D1 = {
+    static constexpr MoveInfo moveInfoT33R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -8372,7 +8372,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ebc9a
     // Track 33. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT33R0D2 = {
+    static constexpr MoveInfo moveInfoT33R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -8409,7 +8409,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ebd9c
     // Track 33. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT33R0D3 = {
+    static constexpr MoveInfo moveInfoT33R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -8446,7 +8446,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcd66
     // Track 34. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT34R0D0 = {
+    static constexpr MoveInfo moveInfoT34R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::up25deg },
         { { 30, 8, 0 }, 0, Pitch::up25deg },
         { { 29, 8, 1 }, 0, Pitch::up25deg },
@@ -8483,7 +8483,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dce68
     // Track 34. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT34R0D1 = {
+    static constexpr MoveInfo moveInfoT34R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::up25deg },
         { { 8, 1, 0 }, 16, Pitch::up25deg },
         { { 8, 2, 1 }, 16, Pitch::up25deg },
@@ -8520,7 +8520,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcf6a
     // Track 34. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT34R0D2 = {
+    static constexpr MoveInfo moveInfoT34R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::up25deg },
         { { 1, 24, 0 }, 32, Pitch::up25deg },
         { { 2, 24, 1 }, 32, Pitch::up25deg },
@@ -8557,7 +8557,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd06c
     // Track 34. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT34R0D3 = {
+    static constexpr MoveInfo moveInfoT34R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::up25deg },
         { { 24, 30, 0 }, 48, Pitch::up25deg },
         { { 24, 29, 1 }, 48, Pitch::up25deg },
@@ -8594,7 +8594,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ddb82
     // Track 34. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT34R1D0 = {
+    static constexpr MoveInfo moveInfoT34R1D0[] = {
         { { 0, 8, 0 }, 32, Pitch::down25deg },
         { { 1, 8, 0 }, 32, Pitch::down25deg },
         { { 2, 8, -1 }, 32, Pitch::down25deg },
@@ -8631,7 +8631,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ddc84
     // Track 34. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT34R1D1 = {
+    static constexpr MoveInfo moveInfoT34R1D1[] = {
         { { 8, 31, 0 }, 48, Pitch::down25deg },
         { { 8, 30, 0 }, 48, Pitch::down25deg },
         { { 8, 29, -1 }, 48, Pitch::down25deg },
@@ -8668,7 +8668,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd97e
     // Track 34. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT34R1D2 = {
+    static constexpr MoveInfo moveInfoT34R1D2[] = {
         { { 31, 24, 0 }, 0, Pitch::down25deg },
         { { 30, 24, 0 }, 0, Pitch::down25deg },
         { { 29, 24, -1 }, 0, Pitch::down25deg },
@@ -8705,7 +8705,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dda80
     // Track 34. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT34R1D3 = {
+    static constexpr MoveInfo moveInfoT34R1D3[] = {
         { { 24, 0, 0 }, 16, Pitch::down25deg },
         { { 24, 1, 0 }, 16, Pitch::down25deg },
         { { 24, 2, -1 }, 16, Pitch::down25deg },
@@ -8742,7 +8742,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd576
     // Track 35. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT35R0D0 = {
+    static constexpr MoveInfo moveInfoT35R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::up25deg },
         { { 30, 24, 0 }, 0, Pitch::up25deg },
         { { 29, 24, 1 }, 0, Pitch::up25deg },
@@ -8779,7 +8779,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd678
     // Track 35. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT35R0D1 = {
+    static constexpr MoveInfo moveInfoT35R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::up25deg },
         { { 24, 1, 0 }, 16, Pitch::up25deg },
         { { 24, 2, 1 }, 16, Pitch::up25deg },
@@ -8816,7 +8816,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd77a
     // Track 35. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT35R0D2 = {
+    static constexpr MoveInfo moveInfoT35R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::up25deg },
         { { 1, 8, 0 }, 32, Pitch::up25deg },
         { { 2, 8, 1 }, 32, Pitch::up25deg },
@@ -8853,7 +8853,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd87c
     // Track 35. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT35R0D3 = {
+    static constexpr MoveInfo moveInfoT35R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::up25deg },
         { { 8, 30, 0 }, 48, Pitch::up25deg },
         { { 8, 29, 1 }, 48, Pitch::up25deg },
@@ -8890,7 +8890,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd372
     // Track 35. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT35R1D0 = {
+    static constexpr MoveInfo moveInfoT35R1D0[] = {
         { { 0, 24, 0 }, 32, Pitch::down25deg },
         { { 1, 24, 0 }, 32, Pitch::down25deg },
         { { 2, 24, -1 }, 32, Pitch::down25deg },
@@ -8927,7 +8927,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd474
     // Track 35. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT35R1D1 = {
+    static constexpr MoveInfo moveInfoT35R1D1[] = {
         { { 24, 31, 0 }, 48, Pitch::down25deg },
         { { 24, 30, 0 }, 48, Pitch::down25deg },
         { { 24, 29, -1 }, 48, Pitch::down25deg },
@@ -8964,7 +8964,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd16e
     // Track 35. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT35R1D2 = {
+    static constexpr MoveInfo moveInfoT35R1D2[] = {
         { { 31, 8, 0 }, 0, Pitch::down25deg },
         { { 30, 8, 0 }, 0, Pitch::down25deg },
         { { 29, 8, -1 }, 0, Pitch::down25deg },
@@ -9001,7 +9001,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd270
     // Track 35. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT35R1D3 = {
+    static constexpr MoveInfo moveInfoT35R1D3[] = {
         { { 8, 0, 0 }, 16, Pitch::down25deg },
         { { 8, 1, 0 }, 16, Pitch::down25deg },
         { { 8, 2, -1 }, 16, Pitch::down25deg },
@@ -9038,7 +9038,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ddd86
     // Track 38. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT38R0D0 = {
+    static constexpr MoveInfo moveInfoT38R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -9075,7 +9075,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dde88
     // Track 38. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT38R0D1 = {
+    static constexpr MoveInfo moveInfoT38R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -9112,7 +9112,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ddf8a
     // Track 38. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT38R0D2 = {
+    static constexpr MoveInfo moveInfoT38R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -9149,7 +9149,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de08c
     // Track 38. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT38R0D3 = {
+    static constexpr MoveInfo moveInfoT38R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -9186,7 +9186,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4deba2
     // Track 38. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT38R1D0 = {
+    static constexpr MoveInfo moveInfoT38R1D0[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -9223,7 +9223,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4deca4
     // Track 38. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT38R1D1 = {
+    static constexpr MoveInfo moveInfoT38R1D1[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -9260,7 +9260,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de99e
     // Track 38. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT38R1D2 = {
+    static constexpr MoveInfo moveInfoT38R1D2[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -9297,7 +9297,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4deaa0
     // Track 38. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT38R1D3 = {
+    static constexpr MoveInfo moveInfoT38R1D3[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -9334,7 +9334,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de18e
     // Track 39. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT39R0D0 = {
+    static constexpr MoveInfo moveInfoT39R0D0[] = {
         { { 31, 16, 0 }, 0, Pitch::flat },
         { { 30, 16, 0 }, 0, Pitch::flat },
         { { 29, 16, 0 }, 0, Pitch::flat },
@@ -9371,7 +9371,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de290
     // Track 39. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT39R0D1 = {
+    static constexpr MoveInfo moveInfoT39R0D1[] = {
         { { 16, 0, 0 }, 16, Pitch::flat },
         { { 16, 1, 0 }, 16, Pitch::flat },
         { { 16, 2, 0 }, 16, Pitch::flat },
@@ -9408,7 +9408,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de392
     // Track 39. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT39R0D2 = {
+    static constexpr MoveInfo moveInfoT39R0D2[] = {
         { { 0, 16, 0 }, 32, Pitch::flat },
         { { 1, 16, 0 }, 32, Pitch::flat },
         { { 2, 16, 0 }, 32, Pitch::flat },
@@ -9445,7 +9445,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de494
     // Track 39. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT39R0D3 = {
+    static constexpr MoveInfo moveInfoT39R0D3[] = {
         { { 16, 31, 0 }, 48, Pitch::flat },
         { { 16, 30, 0 }, 48, Pitch::flat },
         { { 16, 29, 0 }, 48, Pitch::flat },
@@ -9482,7 +9482,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de79a
     // Track 39. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT39R1D0 = {
+    static constexpr MoveInfo moveInfoT39R1D0[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -9519,7 +9519,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de89c
     // Track 39. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT39R1D1 = {
+    static constexpr MoveInfo moveInfoT39R1D1[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -9556,7 +9556,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de596
     // Track 39. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT39R1D2 = {
+    static constexpr MoveInfo moveInfoT39R1D2[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -9593,7 +9593,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4de698
     // Track 39. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT39R1D3 = {
+    static constexpr MoveInfo moveInfoT39R1D3[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -9630,7 +9630,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4deda6
     // Track 42. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoT42R0D0 = {
+    static constexpr MoveInfo moveInfoT42R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 2, Pitch::flat },
@@ -9658,7 +9658,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dee60
     // Track 42. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoT42R0D1 = {
+    static constexpr MoveInfo moveInfoT42R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 18, Pitch::flat },
@@ -9686,7 +9686,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4def1a
     // Track 42. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoT42R0D2 = {
+    static constexpr MoveInfo moveInfoT42R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 34, Pitch::flat },
@@ -9714,7 +9714,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4defd4
     // Track 42. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoT42R0D3 = {
+    static constexpr MoveInfo moveInfoT42R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 50, Pitch::flat },
@@ -9742,7 +9742,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df08e
     // Track 42. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoT42R1D0 = {
+    static constexpr MoveInfo moveInfoT42R1D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 54, Pitch::flat },
@@ -9770,7 +9770,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df148
     // Track 42. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoT42R1D1 = {
+    static constexpr MoveInfo moveInfoT42R1D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 6, Pitch::flat },
@@ -9798,7 +9798,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df202
     // Track 42. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoT42R1D2 = {
+    static constexpr MoveInfo moveInfoT42R1D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 22, Pitch::flat },
@@ -9826,7 +9826,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df2bc
     // Track 42. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoT42R1D3 = {
+    static constexpr MoveInfo moveInfoT42R1D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 38, Pitch::flat },
@@ -9856,7 +9856,7 @@ namespace OpenLoco::World::TrackData
 #pragma region RoadData
     // 0x4dc556
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T0R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T0R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -9893,7 +9893,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc658
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T0R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T0R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -9930,7 +9930,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc75a
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T0R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T0R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -9967,7 +9967,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc85c
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T0R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T0R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -10004,7 +10004,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eaafe
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 62, Pitch::flat },
@@ -10021,7 +10021,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eab60
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 14, Pitch::flat },
@@ -10038,7 +10038,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eabc2
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -10055,7 +10055,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eac24
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 46, Pitch::flat },
@@ -10071,7 +10071,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ead88
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R1D0[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -10110,7 +10110,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eae9a
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R1D1[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -10150,7 +10150,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eafb4
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R1D2[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -10189,7 +10189,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eac7e
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T1R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T1R1D3[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -10227,7 +10227,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4edebe
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -10290,7 +10290,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ee090
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -10354,7 +10354,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ee26a
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -10417,7 +10417,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ee43c
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -10479,7 +10479,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ee880
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R1D0[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -10564,7 +10564,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eeb02
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R1D1[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -10650,7 +10650,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eed8c
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R1D2[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -10735,7 +10735,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ee606
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T3R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T3R1D3[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -10819,7 +10819,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ebe9e
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::up12deg },
         { { 30, 8, 0 }, 0, Pitch::up12deg },
         { { 29, 8, 0 }, 0, Pitch::up12deg },
@@ -10888,7 +10888,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ec0a0
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::up12deg },
         { { 8, 1, 0 }, 16, Pitch::up12deg },
         { { 8, 2, 0 }, 16, Pitch::up12deg },
@@ -10957,7 +10957,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ec2a2
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::up12deg },
         { { 1, 24, 0 }, 32, Pitch::up12deg },
         { { 2, 24, 0 }, 32, Pitch::up12deg },
@@ -11026,7 +11026,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ec4a4
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::up12deg },
         { { 24, 30, 0 }, 48, Pitch::up12deg },
         { { 24, 29, 0 }, 48, Pitch::up12deg },
@@ -11095,7 +11095,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ecaaa
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R1D0[] = {
         { { 0, 24, 0 }, 32, Pitch::down12deg },
         { { 1, 24, 0 }, 32, Pitch::down12deg },
         { { 2, 24, 0 }, 32, Pitch::down12deg },
@@ -11164,7 +11164,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eccac
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R1D1[] = {
         { { 24, 31, 0 }, 48, Pitch::down12deg },
         { { 24, 30, 0 }, 48, Pitch::down12deg },
         { { 24, 29, 0 }, 48, Pitch::down12deg },
@@ -11233,7 +11233,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ec6a6
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R1D2[] = {
         { { 31, 8, 0 }, 0, Pitch::down12deg },
         { { 30, 8, 0 }, 0, Pitch::down12deg },
         { { 29, 8, 0 }, 0, Pitch::down12deg },
@@ -11302,7 +11302,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ec8a8
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T5R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T5R1D3[] = {
         { { 8, 0, 0 }, 16, Pitch::down12deg },
         { { 8, 1, 0 }, 16, Pitch::down12deg },
         { { 8, 2, 0 }, 16, Pitch::down12deg },
@@ -11371,7 +11371,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcd66
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::up25deg },
         { { 30, 8, 0 }, 0, Pitch::up25deg },
         { { 29, 8, 1 }, 0, Pitch::up25deg },
@@ -11408,7 +11408,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dce68
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::up25deg },
         { { 8, 1, 0 }, 16, Pitch::up25deg },
         { { 8, 2, 1 }, 16, Pitch::up25deg },
@@ -11445,7 +11445,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcf6a
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::up25deg },
         { { 1, 24, 0 }, 32, Pitch::up25deg },
         { { 2, 24, 1 }, 32, Pitch::up25deg },
@@ -11482,7 +11482,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd06c
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::up25deg },
         { { 24, 30, 0 }, 48, Pitch::up25deg },
         { { 24, 29, 1 }, 48, Pitch::up25deg },
@@ -11519,7 +11519,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd372
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R1D0[] = {
         { { 0, 24, 0 }, 32, Pitch::down25deg },
         { { 1, 24, 0 }, 32, Pitch::down25deg },
         { { 2, 24, -1 }, 32, Pitch::down25deg },
@@ -11556,7 +11556,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd474
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R1D1[] = {
         { { 24, 31, 0 }, 48, Pitch::down25deg },
         { { 24, 30, 0 }, 48, Pitch::down25deg },
         { { 24, 29, -1 }, 48, Pitch::down25deg },
@@ -11593,7 +11593,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd16e
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R1D2[] = {
         { { 31, 8, 0 }, 0, Pitch::down25deg },
         { { 30, 8, 0 }, 0, Pitch::down25deg },
         { { 29, 8, -1 }, 0, Pitch::down25deg },
@@ -11630,7 +11630,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd270
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T7R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T7R1D3[] = {
         { { 8, 0, 0 }, 16, Pitch::down25deg },
         { { 8, 1, 0 }, 16, Pitch::down25deg },
         { { 8, 2, -1 }, 16, Pitch::down25deg },
@@ -11667,7 +11667,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4deda6
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L0T9R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L0T9R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 2, Pitch::flat },
@@ -11695,7 +11695,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dee60
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L0T9R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L0T9R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 18, Pitch::flat },
@@ -11723,7 +11723,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4def1a
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L0T9R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L0T9R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 34, Pitch::flat },
@@ -11751,7 +11751,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4defd4
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L0T9R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L0T9R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 50, Pitch::flat },
@@ -11779,7 +11779,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dc95e
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T0R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T0R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -11816,7 +11816,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dca60
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T0R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T0R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -11853,7 +11853,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcb62
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T0R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T0R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -11890,7 +11890,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dcc64
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T0R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T0R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -11927,7 +11927,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb350
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -11966,7 +11966,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb462
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -12006,7 +12006,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb57c
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -12045,7 +12045,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb246
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -12083,7 +12083,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb0c6
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R1D0[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -12100,7 +12100,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb128
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R1D1[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 34, Pitch::flat },
@@ -12117,7 +12117,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb18a
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R1D2[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 50, Pitch::flat },
@@ -12134,7 +12134,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eb1ec
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T1R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T1R1D3[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 2, Pitch::flat },
@@ -12150,7 +12150,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ef756
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -12235,7 +12235,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ef9d8
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -12321,7 +12321,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4efc62
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -12406,7 +12406,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4efee4
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -12490,7 +12490,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ef1d8
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R1D0[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -12553,7 +12553,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ef3aa
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R1D1[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -12617,7 +12617,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ef584
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R1D2[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -12680,7 +12680,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ef00e
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T3R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T3R1D3[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -12742,7 +12742,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4eceae
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::up12deg },
         { { 30, 24, 0 }, 0, Pitch::up12deg },
         { { 29, 24, 0 }, 0, Pitch::up12deg },
@@ -12811,7 +12811,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ed0b0
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::up12deg },
         { { 24, 1, 0 }, 16, Pitch::up12deg },
         { { 24, 2, 0 }, 16, Pitch::up12deg },
@@ -12880,7 +12880,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ed2b2
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::up12deg },
         { { 1, 8, 0 }, 32, Pitch::up12deg },
         { { 2, 8, 0 }, 32, Pitch::up12deg },
@@ -12949,7 +12949,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ed4b4
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::up12deg },
         { { 8, 30, 0 }, 48, Pitch::up12deg },
         { { 8, 29, 0 }, 48, Pitch::up12deg },
@@ -13018,7 +13018,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4edaba
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R1D0[] = {
         { { 0, 8, 0 }, 32, Pitch::down12deg },
         { { 1, 8, 0 }, 32, Pitch::down12deg },
         { { 2, 8, 0 }, 32, Pitch::down12deg },
@@ -13087,7 +13087,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4edcbc
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R1D1[] = {
         { { 8, 31, 0 }, 48, Pitch::down12deg },
         { { 8, 30, 0 }, 48, Pitch::down12deg },
         { { 8, 29, 0 }, 48, Pitch::down12deg },
@@ -13156,7 +13156,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ed6b6
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R1D2[] = {
         { { 31, 24, 0 }, 0, Pitch::down12deg },
         { { 30, 24, 0 }, 0, Pitch::down12deg },
         { { 29, 24, 0 }, 0, Pitch::down12deg },
@@ -13225,7 +13225,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ed8b8
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T5R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T5R1D3[] = {
         { { 24, 0, 0 }, 16, Pitch::down12deg },
         { { 24, 1, 0 }, 16, Pitch::down12deg },
         { { 24, 2, 0 }, 16, Pitch::down12deg },
@@ -13294,7 +13294,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd576
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::up25deg },
         { { 30, 24, 0 }, 0, Pitch::up25deg },
         { { 29, 24, 1 }, 0, Pitch::up25deg },
@@ -13331,7 +13331,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd678
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::up25deg },
         { { 24, 1, 0 }, 16, Pitch::up25deg },
         { { 24, 2, 1 }, 16, Pitch::up25deg },
@@ -13368,7 +13368,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd77a
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::up25deg },
         { { 1, 8, 0 }, 32, Pitch::up25deg },
         { { 2, 8, 1 }, 32, Pitch::up25deg },
@@ -13405,7 +13405,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd87c
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::up25deg },
         { { 8, 30, 0 }, 48, Pitch::up25deg },
         { { 8, 29, 1 }, 48, Pitch::up25deg },
@@ -13442,7 +13442,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ddb82
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R1D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R1D0[] = {
         { { 0, 8, 0 }, 32, Pitch::down25deg },
         { { 1, 8, 0 }, 32, Pitch::down25deg },
         { { 2, 8, -1 }, 32, Pitch::down25deg },
@@ -13479,7 +13479,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4ddc84
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R1D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R1D1[] = {
         { { 8, 31, 0 }, 48, Pitch::down25deg },
         { { 8, 30, 0 }, 48, Pitch::down25deg },
         { { 8, 29, -1 }, 48, Pitch::down25deg },
@@ -13516,7 +13516,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dd97e
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R1D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R1D2[] = {
         { { 31, 24, 0 }, 0, Pitch::down25deg },
         { { 30, 24, 0 }, 0, Pitch::down25deg },
         { { 29, 24, -1 }, 0, Pitch::down25deg },
@@ -13553,7 +13553,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4dda80
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T7R1D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T7R1D3[] = {
         { { 24, 0, 0 }, 16, Pitch::down25deg },
         { { 24, 1, 0 }, 16, Pitch::down25deg },
         { { 24, 2, -1 }, 16, Pitch::down25deg },
@@ -13590,7 +13590,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df08e
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA0L1T9R0D0 = {
+    static constexpr MoveInfo moveInfoTA0L1T9R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 54, Pitch::flat },
@@ -13618,7 +13618,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df148
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA0L1T9R0D1 = {
+    static constexpr MoveInfo moveInfoTA0L1T9R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 6, Pitch::flat },
@@ -13646,7 +13646,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df202
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA0L1T9R0D2 = {
+    static constexpr MoveInfo moveInfoTA0L1T9R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 22, Pitch::flat },
@@ -13674,7 +13674,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4df2bc
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA0L1T9R0D3 = {
+    static constexpr MoveInfo moveInfoTA0L1T9R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 38, Pitch::flat },
@@ -13702,7 +13702,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f217e
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T0R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T0R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 9, 0 }, 0, Pitch::flat },
@@ -13739,7 +13739,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2280
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T0R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T0R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 9, 2, 0 }, 16, Pitch::flat },
@@ -13776,7 +13776,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2382
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T0R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T0R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 23, 0 }, 32, Pitch::flat },
@@ -13813,7 +13813,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2484
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T0R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T0R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 23, 29, 0 }, 48, Pitch::flat },
@@ -13850,7 +13850,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f39ae
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -13883,7 +13883,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f3a90
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -13916,7 +13916,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f3b72
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -13949,7 +13949,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f3c54
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -13981,7 +13981,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f3e08
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R1D0[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -14014,7 +14014,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f3eea
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R1D1[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 34, Pitch::flat },
@@ -14047,7 +14047,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f3fcc
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R1D2[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 50, Pitch::flat },
@@ -14080,7 +14080,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f3d2e
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T1R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T1R1D3[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 2, Pitch::flat },
@@ -14112,7 +14112,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f47ae
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -14191,7 +14191,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f4a00
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -14271,7 +14271,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f4c5a
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -14350,7 +14350,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f4eac
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -14428,7 +14428,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f5340
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R1D0[] = {
         { { 8, 0, 0 }, 16, Pitch::flat },
         { { 8, 1, 0 }, 16, Pitch::flat },
         { { 8, 2, 0 }, 16, Pitch::flat },
@@ -14507,7 +14507,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f5592
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R1D1[] = {
         { { 0, 24, 0 }, 32, Pitch::flat },
         { { 1, 24, 0 }, 32, Pitch::flat },
         { { 2, 24, 0 }, 32, Pitch::flat },
@@ -14587,7 +14587,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f57ec
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R1D2[] = {
         { { 24, 31, 0 }, 48, Pitch::flat },
         { { 24, 30, 0 }, 48, Pitch::flat },
         { { 24, 29, 0 }, 48, Pitch::flat },
@@ -14666,7 +14666,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f50f6
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T3R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T3R1D3[] = {
         { { 31, 8, 0 }, 0, Pitch::flat },
         { { 30, 8, 0 }, 0, Pitch::flat },
         { { 29, 8, 0 }, 0, Pitch::flat },
@@ -14744,7 +14744,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f015e
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::up12deg },
         { { 30, 8, 0 }, 0, Pitch::up12deg },
         { { 29, 8, 0 }, 0, Pitch::up12deg },
@@ -14813,7 +14813,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f0360
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::up12deg },
         { { 8, 1, 0 }, 16, Pitch::up12deg },
         { { 8, 2, 0 }, 16, Pitch::up12deg },
@@ -14882,7 +14882,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f0562
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::up12deg },
         { { 1, 24, 0 }, 32, Pitch::up12deg },
         { { 2, 24, 0 }, 32, Pitch::up12deg },
@@ -14951,7 +14951,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f0764
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::up12deg },
         { { 24, 30, 0 }, 48, Pitch::up12deg },
         { { 24, 29, 0 }, 48, Pitch::up12deg },
@@ -15020,7 +15020,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f0d6a
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R1D0[] = {
         { { 0, 24, 0 }, 32, Pitch::down12deg },
         { { 1, 24, 0 }, 32, Pitch::down12deg },
         { { 2, 24, 0 }, 32, Pitch::down12deg },
@@ -15089,7 +15089,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f0f6c
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R1D1[] = {
         { { 24, 31, 0 }, 48, Pitch::down12deg },
         { { 24, 30, 0 }, 48, Pitch::down12deg },
         { { 24, 29, 0 }, 48, Pitch::down12deg },
@@ -15158,7 +15158,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f0966
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R1D2[] = {
         { { 31, 8, 0 }, 0, Pitch::down12deg },
         { { 30, 8, 0 }, 0, Pitch::down12deg },
         { { 29, 8, 0 }, 0, Pitch::down12deg },
@@ -15227,7 +15227,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f0b68
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T5R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T5R1D3[] = {
         { { 8, 0, 0 }, 16, Pitch::down12deg },
         { { 8, 1, 0 }, 16, Pitch::down12deg },
         { { 8, 2, 0 }, 16, Pitch::down12deg },
@@ -15296,7 +15296,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f298e
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R0D0[] = {
         { { 31, 8, 0 }, 0, Pitch::up25deg },
         { { 30, 8, 0 }, 0, Pitch::up25deg },
         { { 29, 9, 1 }, 0, Pitch::up25deg },
@@ -15333,7 +15333,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2a90
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R0D1[] = {
         { { 8, 0, 0 }, 16, Pitch::up25deg },
         { { 8, 1, 0 }, 16, Pitch::up25deg },
         { { 9, 2, 1 }, 16, Pitch::up25deg },
@@ -15370,7 +15370,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2b92
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R0D2[] = {
         { { 0, 24, 0 }, 32, Pitch::up25deg },
         { { 1, 24, 0 }, 32, Pitch::up25deg },
         { { 2, 23, 1 }, 32, Pitch::up25deg },
@@ -15407,7 +15407,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2c94
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R0D3[] = {
         { { 24, 31, 0 }, 48, Pitch::up25deg },
         { { 24, 30, 0 }, 48, Pitch::up25deg },
         { { 23, 29, 1 }, 48, Pitch::up25deg },
@@ -15444,7 +15444,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2f9a
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R1D0[] = {
         { { 0, 24, 0 }, 32, Pitch::down25deg },
         { { 1, 24, 0 }, 32, Pitch::down25deg },
         { { 2, 23, -1 }, 32, Pitch::down25deg },
@@ -15481,7 +15481,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f309c
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R1D1[] = {
         { { 24, 31, 0 }, 48, Pitch::down25deg },
         { { 24, 30, 0 }, 48, Pitch::down25deg },
         { { 23, 29, -1 }, 48, Pitch::down25deg },
@@ -15518,7 +15518,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2d96
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R1D2[] = {
         { { 31, 8, 0 }, 0, Pitch::down25deg },
         { { 30, 8, 0 }, 0, Pitch::down25deg },
         { { 29, 9, -1 }, 0, Pitch::down25deg },
@@ -15555,7 +15555,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2e98
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L0T7R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L0T7R1D3[] = {
         { { 8, 0, 0 }, 16, Pitch::down25deg },
         { { 8, 1, 0 }, 16, Pitch::down25deg },
         { { 9, 2, -1 }, 16, Pitch::down25deg },
@@ -15592,7 +15592,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2586
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T0R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T0R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 23, 0 }, 0, Pitch::flat },
@@ -15629,7 +15629,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f2688
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T0R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T0R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 23, 2, 0 }, 16, Pitch::flat },
@@ -15666,7 +15666,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f278a
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T0R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T0R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 9, 0 }, 32, Pitch::flat },
@@ -15703,7 +15703,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f288c
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T0R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T0R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 9, 29, 0 }, 48, Pitch::flat },
@@ -15740,7 +15740,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f4508
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 62, Pitch::flat },
@@ -15773,7 +15773,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f45ea
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 14, Pitch::flat },
@@ -15806,7 +15806,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f46cc
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -15839,7 +15839,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f442e
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 46, Pitch::flat },
@@ -15871,7 +15871,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f40ae
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R1D0[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -15904,7 +15904,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f4190
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R1D1[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -15937,7 +15937,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f4272
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R1D2[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -15970,7 +15970,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f4354
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T1R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T1R1D3[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -16002,7 +16002,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f65d0
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -16081,7 +16081,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f6822
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -16161,7 +16161,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f6a7c
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -16240,7 +16240,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f6386
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -16318,7 +16318,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f5a3e
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R1D0[] = {
         { { 24, 0, 0 }, 16, Pitch::flat },
         { { 24, 1, 0 }, 16, Pitch::flat },
         { { 24, 2, 0 }, 16, Pitch::flat },
@@ -16397,7 +16397,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f5c90
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R1D1[] = {
         { { 0, 8, 0 }, 32, Pitch::flat },
         { { 1, 8, 0 }, 32, Pitch::flat },
         { { 2, 8, 0 }, 32, Pitch::flat },
@@ -16477,7 +16477,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f5eea
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R1D2[] = {
         { { 8, 31, 0 }, 48, Pitch::flat },
         { { 8, 30, 0 }, 48, Pitch::flat },
         { { 8, 29, 0 }, 48, Pitch::flat },
@@ -16556,7 +16556,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f613c
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T3R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T3R1D3[] = {
         { { 31, 24, 0 }, 0, Pitch::flat },
         { { 30, 24, 0 }, 0, Pitch::flat },
         { { 29, 24, 0 }, 0, Pitch::flat },
@@ -16634,7 +16634,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f116e
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::up12deg },
         { { 30, 24, 0 }, 0, Pitch::up12deg },
         { { 29, 24, 0 }, 0, Pitch::up12deg },
@@ -16703,7 +16703,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f1370
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::up12deg },
         { { 24, 1, 0 }, 16, Pitch::up12deg },
         { { 24, 2, 0 }, 16, Pitch::up12deg },
@@ -16772,7 +16772,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f1572
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::up12deg },
         { { 1, 8, 0 }, 32, Pitch::up12deg },
         { { 2, 8, 0 }, 32, Pitch::up12deg },
@@ -16841,7 +16841,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f1774
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::up12deg },
         { { 8, 30, 0 }, 48, Pitch::up12deg },
         { { 8, 29, 0 }, 48, Pitch::up12deg },
@@ -16910,7 +16910,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f1d7a
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R1D0[] = {
         { { 0, 8, 0 }, 32, Pitch::down12deg },
         { { 1, 8, 0 }, 32, Pitch::down12deg },
         { { 2, 8, 0 }, 32, Pitch::down12deg },
@@ -16979,7 +16979,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f1f7c
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R1D1[] = {
         { { 8, 31, 0 }, 48, Pitch::down12deg },
         { { 8, 30, 0 }, 48, Pitch::down12deg },
         { { 8, 29, 0 }, 48, Pitch::down12deg },
@@ -17048,7 +17048,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f1976
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R1D2[] = {
         { { 31, 24, 0 }, 0, Pitch::down12deg },
         { { 30, 24, 0 }, 0, Pitch::down12deg },
         { { 29, 24, 0 }, 0, Pitch::down12deg },
@@ -17117,7 +17117,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f1b78
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T5R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T5R1D3[] = {
         { { 24, 0, 0 }, 16, Pitch::down12deg },
         { { 24, 1, 0 }, 16, Pitch::down12deg },
         { { 24, 2, 0 }, 16, Pitch::down12deg },
@@ -17186,7 +17186,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f319e
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R0D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R0D0[] = {
         { { 31, 24, 0 }, 0, Pitch::up25deg },
         { { 30, 24, 0 }, 0, Pitch::up25deg },
         { { 29, 23, 1 }, 0, Pitch::up25deg },
@@ -17223,7 +17223,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f32a0
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R0D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R0D1[] = {
         { { 24, 0, 0 }, 16, Pitch::up25deg },
         { { 24, 1, 0 }, 16, Pitch::up25deg },
         { { 23, 2, 1 }, 16, Pitch::up25deg },
@@ -17260,7 +17260,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f33a2
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R0D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R0D2[] = {
         { { 0, 8, 0 }, 32, Pitch::up25deg },
         { { 1, 8, 0 }, 32, Pitch::up25deg },
         { { 2, 9, 1 }, 32, Pitch::up25deg },
@@ -17297,7 +17297,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f34a4
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R0D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R0D3[] = {
         { { 8, 31, 0 }, 48, Pitch::up25deg },
         { { 8, 30, 0 }, 48, Pitch::up25deg },
         { { 9, 29, 1 }, 48, Pitch::up25deg },
@@ -17334,7 +17334,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f37aa
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 0
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R1D0 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R1D0[] = {
         { { 0, 8, 0 }, 32, Pitch::down25deg },
         { { 1, 8, 0 }, 32, Pitch::down25deg },
         { { 2, 9, -1 }, 32, Pitch::down25deg },
@@ -17371,7 +17371,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f38ac
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 1
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R1D1 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R1D1[] = {
         { { 8, 31, 0 }, 48, Pitch::down25deg },
         { { 8, 30, 0 }, 48, Pitch::down25deg },
         { { 9, 29, -1 }, 48, Pitch::down25deg },
@@ -17408,7 +17408,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f35a6
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 2
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R1D2 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R1D2[] = {
         { { 31, 24, 0 }, 0, Pitch::down25deg },
         { { 30, 24, 0 }, 0, Pitch::down25deg },
         { { 29, 23, -1 }, 0, Pitch::down25deg },
@@ -17445,7 +17445,7 @@ namespace OpenLoco::World::TrackData
 
     // 0x4f36a8
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 3
-    static const std::vector<MoveInfo> moveInfoTA1L1T7R1D3 = {
+    static constexpr MoveInfo moveInfoTA1L1T7R1D3[] = {
         { { 24, 0, 0 }, 16, Pitch::down25deg },
         { { 24, 1, 0 }, 16, Pitch::down25deg },
         { { 23, 2, -1 }, 16, Pitch::down25deg },
@@ -17483,7 +17483,7 @@ namespace OpenLoco::World::TrackData
 #pragma endregion
 
     // 0x004D9724 44 track ids * 8 directions
-    static const std::array<std::vector<MoveInfo>, 44 * 8> _4D9724 = {
+    static constexpr std::array<stdx::span<const MoveInfo>, 44 * 8> _4D9724 = {
         moveInfoT0R0D0,
         moveInfoT0R0D1,
         moveInfoT0R0D2,
@@ -17839,9 +17839,9 @@ namespace OpenLoco::World::TrackData
     };
 
     // 0x004D9DE4
-    static const std::array<std::array<std::array<std::vector<MoveInfo>, 10 * 8>, 2>, 2> _4D9DE4 = {
-        std::array<std::array<std::vector<MoveInfo>, 10 * 8>, 2>{
-            std::array<std::vector<MoveInfo>, 10 * 8>{
+    static constexpr std::array<std::array<std::array<stdx::span<const MoveInfo>, 10 * 8>, 2>, 2> _4D9DE4 = {
+        std::array<std::array<stdx::span<const MoveInfo>, 10 * 8>, 2>{
+            std::array<stdx::span<const MoveInfo>, 10 * 8>{
                 moveInfoTA0L0T0R0D0,
                 moveInfoTA0L0T0R0D1,
                 moveInfoTA0L0T0R0D2,
@@ -18006,8 +18006,8 @@ namespace OpenLoco::World::TrackData
                 moveInfoTA0L1T9R0D3,
             },
         },
-        std::array<std::array<std::vector<MoveInfo>, 10 * 8>, 2>{
-            std::array<std::vector<MoveInfo>, 10 * 8>{
+        std::array<std::array<stdx::span<const MoveInfo>, 10 * 8>, 2>{
+            std::array<stdx::span<const MoveInfo>, 10 * 8>{
                 moveInfoTA1L0T0R0D0,
                 moveInfoTA1L0T0R0D1,
                 moveInfoTA1L0T0R0D2,
@@ -18175,9 +18175,9 @@ namespace OpenLoco::World::TrackData
     };
 
     // 0x004D9DE4
-    static const std::array<std::array<std::array<std::vector<MoveInfo>, 10 * 8>, 2>, 2> _rightHand4D9DE4 = {
-        std::array<std::array<std::vector<MoveInfo>, 10 * 8>, 2>{
-            std::array<std::vector<MoveInfo>, 10 * 8>{
+    static constexpr std::array<std::array<std::array<stdx::span<const MoveInfo>, 10 * 8>, 2>, 2> _rightHand4D9DE4 = {
+        std::array<std::array<stdx::span<const MoveInfo>, 10 * 8>, 2>{
+            std::array<stdx::span<const MoveInfo>, 10 * 8>{
                 moveInfoTA0L1T0R0D0,
                 moveInfoTA0L1T0R0D1,
                 moveInfoTA0L1T0R0D2,
@@ -18343,8 +18343,8 @@ namespace OpenLoco::World::TrackData
             },
 
         },
-        std::array<std::array<std::vector<MoveInfo>, 10 * 8>, 2>{
-            std::array<std::vector<MoveInfo>, 10 * 8>{
+        std::array<std::array<stdx::span<const MoveInfo>, 10 * 8>, 2>{
+            std::array<stdx::span<const MoveInfo>, 10 * 8>{
                 moveInfoTA1L1T0R0D0,
                 moveInfoTA1L1T0R0D1,
                 moveInfoTA1L1T0R0D2,
@@ -18513,7 +18513,7 @@ namespace OpenLoco::World::TrackData
 
     static loco_global<const MoveInfo* [80], 0x04D9CA4> _4D9CA4; // 10 roadId's * 8 directions
 
-    const std::vector<MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection)
+    stdx::span<const MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection)
     {
         // TODO: rework after 0x0047D9F2 is implemented and hooked
         // 0x005253B0
@@ -18521,22 +18521,17 @@ namespace OpenLoco::World::TrackData
         return data[trackAndDirection & (1 << 8) ? 1 : 0][trackAndDirection & (1 << 7) ? 1 : 0][trackAndDirection & 0x7F];
     }
 
-    const std::vector<MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection)
+    stdx::span<const MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection)
     {
         return _4D9724[trackAndDirection];
     }
 
-    const std::vector<MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection)
+    stdx::span<const MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection)
     {
         // TODO: investigate if this mirrors one side of getRoadSubPositon
+        // The number of entries is stored just before the first entry
         auto* moveInfoStart = _4D9CA4[trackAndDirection];
         auto moveInfoSize = *(reinterpret_cast<const uint16_t*>(moveInfoStart) - 1);
-        std::vector<MoveInfo> moveInfoArr;
-        moveInfoArr.resize(moveInfoSize);
-        for (auto i = 0; i < moveInfoSize; ++i)
-        {
-            moveInfoArr[i] = moveInfoStart[i];
-        }
-        return moveInfoArr;
+        return stdx::span<const MoveInfo>(moveInfoStart, moveInfoSize);
     }
 }
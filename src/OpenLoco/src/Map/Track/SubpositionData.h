@@ -1,8 +1,8 @@
 #pragma once
 
 #include "Types.hpp"
+#include <OpenLoco/Core/Span.hpp>
 #include <OpenLoco/Engine/World.hpp>
-#include <vector>
 
 namespace OpenLoco
 {
@@ -21,7 +21,8 @@ namespace OpenLoco::World::TrackData
 #pragma pack(pop)
     static_assert(sizeof(MoveInfo) == 0x8);
 
-    const std::vector<MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection);
-    const std::vector<MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection);
-    const std::vector<MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection);
+    // The returned tables are static and valid for the lifetime of the game
+    stdx::span<const MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection);
+    stdx::span<const MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection);
+    stdx::span<const MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection);
 }
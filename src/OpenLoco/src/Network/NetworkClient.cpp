@@ -8,11 +8,17 @@
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Platform/Platform.h>
 #include <OpenLoco/Utility/Stream.hpp>
+#include <cstring>
+#include <optional>
+#include <zlib.h>
 
 using namespace OpenLoco;
 using namespace OpenLoco::Network;
 using namespace OpenLoco::Diagnostics;
 
+// Larger than any S5 game state, a server asking for more is not to be trusted
+constexpr uint32_t kMaxStateSize = 64 * 1024 * 1024;
+
 NetworkClient::~NetworkClient()
 {
     close();
@@ -191,6 +197,7 @@ void NetworkClient::sendConnectPacket()
 void NetworkClient::sendRequestStatePacket()
 {
     _requestStateCookie = (std::rand() << 16) | std::rand();
+    _requestStateData.clear();
     _requestStateChunksReceived.clear();
 
     RequestStatePacket packet;
@@ -212,50 +219,106 @@ void NetworkClient::receiveConnectionResponsePacket(const ConnectResponsePacket&
     }
 }
 
+bool NetworkClient::beginReceiveState(uint32_t totalSize, uint16_t numChunks)
+{
+    if (!_requestStateData.empty())
+    {
+        return true;
+    }
+    if (totalSize == 0 || totalSize > kMaxStateSize)
+    {
+        Logging::error("Server sent a state of invalid size: {} bytes", totalSize);
+        close();
+        endStatus("Received invalid state from server");
+        return false;
+    }
+
+    _requestStateTotalSize = totalSize;
+    _requestStateNumChunks = numChunks;
+    _requestStateData.resize(totalSize);
+    _requestStateChunksReceived.assign(numChunks, false);
+    _requestStateReceivedBytes = 0;
+    _requestStateReceivedChunks = 0;
+    return true;
+}
+
+static std::optional<std::vector<uint8_t>> decompressState(const std::vector<uint8_t>& data)
+{
+    uint32_t stateSize{};
+    if (data.size() < sizeof(stateSize))
+    {
+        return std::nullopt;
+    }
+    std::memcpy(&stateSize, data.data(), sizeof(stateSize));
+    if (stateSize < sizeof(ExtraState) || stateSize > kMaxStateSize)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<uint8_t> state(stateSize);
+    uLongf inflatedSize = stateSize;
+    const auto result = uncompress(state.data(), &inflatedSize, data.data() + sizeof(stateSize), static_cast<uLong>(data.size() - sizeof(stateSize)));
+    if (result != Z_OK || inflatedSize != stateSize)
+    {
+        return std::nullopt;
+    }
+    return state;
+}
+
 void NetworkClient::receiveRequestStateResponsePacket(const RequestStateResponse& response)
 {
     if (response.cookie == _requestStateCookie)
     {
-        _requestStateNumChunks = response.numChunks;
-        _requestStateTotalSize = response.totalSize;
-        _requestStateReceivedChunks = 0;
+        beginReceiveState(response.totalSize, response.numChunks);
     }
 }
 
 void NetworkClient::receiveRequestStateResponseChunkPacket(const RequestStateResponseChunk& responseChunk)
 {
-    if (responseChunk.cookie == _requestStateCookie)
+    if (_status != NetworkClientStatus::waitingForState || responseChunk.cookie != _requestStateCookie)
     {
-        if (_requestStateChunksReceived.size() <= responseChunk.index)
-        {
-            _requestStateChunksReceived.resize(responseChunk.index + 1);
-        }
-
-        auto& rchunk = _requestStateChunksReceived[responseChunk.index];
-        if (rchunk.data.size() == 0)
-        {
-            rchunk.offset = responseChunk.offset;
-            rchunk.data.assign(responseChunk.data, responseChunk.data + responseChunk.dataSize);
-            _requestStateReceivedChunks++;
+        return;
+    }
 
-            _requestStateReceivedBytes += responseChunk.dataSize;
-            setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateTotalSize));
-        }
+    // Chunks may arrive before the response
+    if (!beginReceiveState(responseChunk.totalSize, responseChunk.numChunks))
+    {
+        return;
+    }
+    if (responseChunk.index >= _requestStateNumChunks
+        || responseChunk.dataSize > sizeof(responseChunk.data)
+        || responseChunk.offset > _requestStateTotalSize
+        || responseChunk.dataSize > _requestStateTotalSize - responseChunk.offset)
+    {
+        return;
+    }
 
-        if (_requestStateReceivedChunks >= _requestStateNumChunks)
-        {
-            // Construct full data
-            std::vector<uint8_t> fullData;
-            for (size_t i = 0; i < _requestStateChunksReceived.size(); i++)
-            {
-                fullData.insert(fullData.end(), _requestStateChunksReceived[i].data.begin(), _requestStateChunksReceived[i].data.end());
-            }
+    if (!_requestStateChunksReceived[responseChunk.index])
+    {
+        _requestStateChunksReceived[responseChunk.index] = true;
+        std::memcpy(_requestStateData.data() + responseChunk.offset, responseChunk.data, responseChunk.dataSize);
+        _requestStateReceivedChunks++;
 
-            clearStatus();
-            _status = NetworkClientStatus::connected;
+        _requestStateReceivedBytes += responseChunk.dataSize;
+        setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateTotalSize));
+    }
 
-            processFullState(fullData);
+    if (_requestStateReceivedChunks >= _requestStateNumChunks)
+    {
+        auto fullData = decompressState(_requestStateData);
+        _requestStateData = {};
+        _requestStateChunksReceived = {};
+        if (!fullData)
+        {
+            Logging::error("Unable to decompress state received from server");
+            close();
+            endStatus("Received invalid state from server");
+            return;
         }
+
+        clearStatus();
+        _status = NetworkClientStatus::connected;
+        processFullState(*fullData);
     }
 }
 
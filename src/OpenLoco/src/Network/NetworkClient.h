@@ -35,16 +35,12 @@ namespace OpenLoco::Network
         uint32_t _serverTick;
         std::list<GameCommandPacket> _receivedGameCommands;
 
-        struct ReceivedChunk
-        {
-            uint32_t offset{};
-            std::vector<uint8_t> data;
-        };
-
         uint32_t _requestStateCookie{};
         uint32_t _requestStateTotalSize{};
         uint16_t _requestStateNumChunks{};
-        std::vector<ReceivedChunk> _requestStateChunksReceived;
+        // Preallocated from the total size, chunks are copied in at their offset
+        std::vector<uint8_t> _requestStateData;
+        std::vector<bool> _requestStateChunksReceived;
         uint32_t _requestStateReceivedBytes{};
         uint32_t _requestStateReceivedChunks{};
 
@@ -52,6 +48,7 @@ namespace OpenLoco::Network
         void processReceivedPackets();
         bool hasTimedOut() const;
         void onReceivePacketFromServer(const Packet& packet);
+        bool beginReceiveState(uint32_t totalSize, uint16_t numChunks);
         void processFullState(stdx::span<uint8_t const> data);
         void updateLocalTick();
 
@@ -1,17 +1,20 @@
 #include "NetworkConnection.h"
 #include "Logging.h"
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
 #include <cstring>
 
 using namespace OpenLoco::Network;
 
 constexpr uint32_t kRedeliverTimeout = 1000;
 constexpr uint32_t kConnectionTimeout = 15000;
+constexpr size_t kInitialSentPacketsSize = 64;
 
 NetworkConnection::NetworkConnection(IUdpSocket* socket, std::unique_ptr<INetworkEndpoint> endpoint)
     : _socket(socket)
     , _endpoint(std::move(endpoint))
 {
+    _sentPackets.resize(kInitialSentPacketsSize);
 }
 
 const INetworkEndpoint& NetworkConnection::getEndpoint() const
@@ -34,6 +37,28 @@ bool NetworkConnection::hasTimedOut() const
     return false;
 }
 
+size_t NetworkConnection::getNumUndeliveredPackets()
+{
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    return _numSentPackets;
+}
+
+ConnectionStats NetworkConnection::getStats()
+{
+    ConnectionStats stats;
+    {
+        std::unique_lock<std::mutex> lk(_sentPacketsSync);
+        stats.roundTripTime = _roundTripTime;
+        stats.numResends = _numResends;
+        stats.numUndeliveredPackets = static_cast<uint32_t>(_numSentPackets);
+    }
+    {
+        std::unique_lock<std::mutex> lk(_receivedPacketsSync);
+        stats.numReceivedPackets = static_cast<uint32_t>(_receivedPackets.size());
+    }
+    return stats;
+}
+
 void NetworkConnection::update()
 {
     resendUndeliveredPackets();
@@ -41,20 +66,39 @@ void NetworkConnection::update()
 
 bool NetworkConnection::checkOrRecordReceivedSequence(sequence_t sequence)
 {
-    for (auto s : _receivedSequences)
+    if (!_hasReceivedSequence)
+    {
+        _hasReceivedSequence = true;
+        _latestReceivedSequence = sequence;
+        _receivedSequences.set(sequence % kReceivedSequenceWindow);
+        return false;
+    }
+
+    auto ahead = static_cast<int16_t>(sequence - _latestReceivedSequence);
+    if (ahead > 0)
     {
-        if (s == sequence)
+        // Forget the sequences that the window moves past
+        auto numCleared = std::min<size_t>(ahead, kReceivedSequenceWindow);
+        for (size_t i = 1; i <= numCleared; i++)
         {
-            return true;
+            _receivedSequences.reset(static_cast<sequence_t>(_latestReceivedSequence + i) % kReceivedSequenceWindow);
         }
+        _latestReceivedSequence = sequence;
+        _receivedSequences.set(sequence % kReceivedSequenceWindow);
+        return false;
     }
 
-    while (_receivedSequences.size() >= 1024)
+    if (static_cast<size_t>(-ahead) >= kReceivedSequenceWindow)
     {
-        _receivedSequences.pop_back();
+        // Too old to know, assume it is a duplicate
+        return true;
     }
 
-    _receivedSequences.push_back(sequence);
+    if (_receivedSequences.test(sequence % kReceivedSequenceWindow))
+    {
+        return true;
+    }
+    _receivedSequences.set(sequence % kReceivedSequenceWindow);
     return false;
 }
 
@@ -97,29 +141,82 @@ void NetworkConnection::sendPacket(PacketKind kind, size_t dataSize, const void*
 
 void NetworkConnection::sendPacket(const Packet& packet)
 {
+    size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
     if (packet.header.kind != PacketKind::ack)
     {
         std::unique_lock<std::mutex> lk(_sentPacketsSync);
-        auto timestamp = getTime();
-        _sentPackets.push_back({ timestamp, packet });
+        recordSentPacket(packet, packetSize);
     }
 
-    size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
     _socket->sendData(*_endpoint, &packet, packetSize);
     logPacket(packet, true, false);
 }
 
-void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
+NetworkConnection::SentPacket& NetworkConnection::getSentPacket(sequence_t sequence)
 {
-    std::unique_lock<std::mutex> lk(_sentPacketsSync);
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    return _sentPackets[sequence & (_sentPackets.size() - 1)];
+}
+
+void NetworkConnection::growSentPackets()
+{
+    std::vector<SentPacket> sentPackets(_sentPackets.size() * 2);
+    for (auto& sentPacket : _sentPackets)
     {
-        if (_sentPackets[i].packet.header.sequence == sequence)
+        if (sentPacket.inUse)
         {
-            _sentPackets.erase(_sentPackets.begin() + i);
-            break;
+            sentPackets[sentPacket.sequence & (sentPackets.size() - 1)] = std::move(sentPacket);
         }
     }
+    _sentPackets = std::move(sentPackets);
+}
+
+void NetworkConnection::recordSentPacket(const Packet& packet, size_t packetSize)
+{
+    auto sequence = packet.header.sequence;
+    if (_numSentPackets == 0)
+    {
+        _oldestSentSequence = sequence;
+    }
+    while (static_cast<sequence_t>(sequence - _oldestSentSequence) >= _sentPackets.size())
+    {
+        growSentPackets();
+    }
+
+    auto& sentPacket = getSentPacket(sequence);
+    auto bytes = reinterpret_cast<const uint8_t*>(&packet);
+    sentPacket.inUse = true;
+    sentPacket.resent = false;
+    sentPacket.sequence = sequence;
+    sentPacket.firstSentTime = getTime();
+    sentPacket.timestamp = sentPacket.firstSentTime;
+    sentPacket.data.assign(bytes, bytes + packetSize);
+
+    _newestSentSequence = sequence;
+    _numSentPackets++;
+}
+
+void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
+{
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    auto& sentPacket = getSentPacket(sequence);
+    if (!sentPacket.inUse || sentPacket.sequence != sequence)
+    {
+        return;
+    }
+
+    // A resent packet can not tell which send the ACK is for
+    if (!sentPacket.resent)
+    {
+        auto roundTripTime = getTime() - sentPacket.firstSentTime;
+        _roundTripTime = _roundTripTime == 0 ? roundTripTime : (_roundTripTime * 7 + roundTripTime) / 8;
+    }
+
+    sentPacket.inUse = false;
+    _numSentPackets--;
+    while (_numSentPackets != 0 && !getSentPacket(_oldestSentSequence).inUse)
+    {
+        _oldestSentSequence++;
+    }
 }
 
 void NetworkConnection::sendAcknowledgePacket(sequence_t sequence)
@@ -134,19 +231,26 @@ void NetworkConnection::sendAcknowledgePacket(sequence_t sequence)
 void NetworkConnection::resendUndeliveredPackets()
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    if (_numSentPackets == 0)
+    {
+        return;
+    }
+
     auto now = getTime();
     auto timestamp = now - kRedeliverTimeout;
 
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    size_t count = static_cast<sequence_t>(_newestSentSequence - _oldestSentSequence) + 1;
+    for (size_t i = 0; i < count; i++)
     {
-        auto& sentPacket = _sentPackets[i];
-        if (sentPacket.timestamp < timestamp)
+        auto& sentPacket = getSentPacket(static_cast<sequence_t>(_oldestSentSequence + i));
+        if (sentPacket.inUse && sentPacket.timestamp < timestamp)
         {
-            size_t packetSize = sizeof(PacketHeader) + sentPacket.packet.header.dataSize;
-            _socket->sendData(*_endpoint, &sentPacket.packet, packetSize);
-            logPacket(sentPacket.packet, true, true);
+            _socket->sendData(*_endpoint, sentPacket.data.data(), sentPacket.data.size());
+            logPacket(*reinterpret_cast<const Packet*>(sentPacket.data.data()), true, true);
 
             sentPacket.timestamp = now;
+            sentPacket.resent = true;
+            _numResends++;
         }
     }
 }
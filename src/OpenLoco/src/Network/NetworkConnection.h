@@ -3,38 +3,69 @@
 #include "Network.h"
 #include "Packet.h"
 #include "Socket.h"
+#include <bitset>
 #include <cassert>
 #include <cstdint>
-#include <deque>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace OpenLoco::Network
 {
+    struct ConnectionStats
+    {
+        // Smoothed round trip time in milliseconds, only measured from packets that were not resent
+        uint32_t roundTripTime{};
+        uint32_t numResends{};
+        // Sent packets waiting for an ACK
+        uint32_t numUndeliveredPackets{};
+        // Received packets that have not been taken yet
+        uint32_t numReceivedPackets{};
+    };
+
     class NetworkConnection
     {
     private:
         struct SentPacket
         {
-            uint32_t timestamp;
-            Packet packet;
+            bool inUse{};
+            bool resent{};
+            sequence_t sequence{};
+            uint32_t firstSentTime{};
+            uint32_t timestamp{};
+            // Header followed by the used part of the packet data
+            std::vector<uint8_t> data;
         };
 
+        static constexpr size_t kReceivedSequenceWindow = 1024;
+
         IUdpSocket* _socket;
         std::unique_ptr<INetworkEndpoint> _endpoint;
         std::mutex _sentPacketsSync;
         std::mutex _receivedPacketsSync;
+        // Ring buffer indexed by sequence, its size is a power of two that covers every undelivered sequence
         std::vector<SentPacket> _sentPackets;
+        sequence_t _oldestSentSequence{};
+        sequence_t _newestSentSequence{};
+        size_t _numSentPackets{};
         std::queue<Packet> _receivedPackets;
-        std::deque<sequence_t> _receivedSequences;
+        // Indexed by sequence, covers the sequences up to the latest received one
+        std::bitset<kReceivedSequenceWindow> _receivedSequences;
+        sequence_t _latestReceivedSequence{};
+        bool _hasReceivedSequence{};
         uint16_t _sendSequence{};
         uint32_t _timeOfLastReceivedPacket{};
+        uint32_t _roundTripTime{};
+        uint32_t _numResends{};
 
         static uint32_t getTime();
         bool checkOrRecordReceivedSequence(sequence_t sequence);
+        SentPacket& getSentPacket(sequence_t sequence);
+        void growSentPackets();
+        void recordSentPacket(const Packet& packet, size_t packetSize);
         void receiveAcknowledgePacket(sequence_t sequence);
         void sendAcknowledgePacket(sequence_t sequence);
         void resendUndeliveredPackets();
@@ -46,6 +77,9 @@ namespace OpenLoco::Network
 
         const INetworkEndpoint& getEndpoint() const;
         bool hasTimedOut() const;
+        // Number of sent packets that are still waiting for an ACK
+        size_t getNumUndeliveredPackets();
+        ConnectionStats getStats();
         void update();
         void receivePacket(const Packet& packet);
         void sendPacket(const Packet& packet);
@@ -10,12 +10,17 @@
 #include <OpenLoco/Platform/Platform.h>
 #include <OpenLoco/Utility/Stream.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <cstring>
+#include <zlib.h>
 
 using namespace OpenLoco;
 using namespace OpenLoco::Network;
 using namespace OpenLoco::Diagnostics;
 
 constexpr uint32_t kPingInterval = 30;
+constexpr uint32_t kStateChunkSize = 4000;
+// Maximum number of packets waiting for an ACK before more state chunks are sent
+constexpr size_t kStateTransferWindow = 32;
 
 NetworkServer::~NetworkServer()
 {
@@ -143,10 +148,25 @@ void NetworkServer::onReceivePacketFromClient(Client& client, const Packet& pack
     }
 }
 
-void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestStatePacket& request)
+static std::vector<uint8_t> compressState(const MemoryStream& state)
 {
-    constexpr uint16_t kChunkSize = 4000;
+    // The size of the state goes first so the client knows how much to inflate
+    const auto stateSize = static_cast<uint32_t>(state.getLength());
+    auto compressedSize = compressBound(stateSize);
+    std::vector<uint8_t> compressed(sizeof(stateSize) + compressedSize);
+    std::memcpy(compressed.data(), &stateSize, sizeof(stateSize));
+
+    const auto* src = static_cast<const Bytef*>(state.data());
+    if (compress2(compressed.data() + sizeof(stateSize), &compressedSize, src, stateSize, Z_DEFAULT_COMPRESSION) != Z_OK)
+    {
+        throw std::runtime_error("Unable to compress game state");
+    }
+    compressed.resize(sizeof(stateSize) + compressedSize);
+    return compressed;
+}
 
+void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestStatePacket& request)
+{
     // Dump S5 data to stream
     MemoryStream ms;
     S5::exportGameStateToFile(ms, S5::SaveFlags::noWindowClose);
@@ -157,28 +177,50 @@ void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestSta
     extra.tick = ScenarioManager::getScenarioTicks();
     ms.write(&extra, sizeof(extra));
 
+    // A repeated request replaces the transfer that is in progress
+    auto& transfer = client.stateTransfer.emplace();
+    transfer.cookie = request.cookie;
+    transfer.data = compressState(ms);
+    transfer.numChunks = static_cast<uint16_t>((transfer.data.size() + (kStateChunkSize - 1)) / kStateChunkSize);
+    Logging::info("Sending state to {}: {} bytes, compressed to {} bytes", client.name, ms.getLength(), transfer.data.size());
+
     RequestStateResponse response;
-    response.cookie = request.cookie;
-    response.totalSize = ms.getLength();
-    response.numChunks = static_cast<uint16_t>((ms.getLength() + (kChunkSize - 1)) / kChunkSize);
+    response.cookie = transfer.cookie;
+    response.totalSize = static_cast<uint32_t>(transfer.data.size());
+    response.numChunks = transfer.numChunks;
     client.connection->sendPacket(response);
 
-    uint32_t offset = 0;
-    uint32_t remaining = response.totalSize;
-    uint16_t index = 0;
-    while (index < response.numChunks)
+    // The chunks are sent by updateClients as the client acknowledges them
+    sendStateChunks(client);
+}
+
+void NetworkServer::sendStateChunks(Client& client)
+{
+    auto& transfer = *client.stateTransfer;
+    auto numUndelivered = client.connection->getNumUndeliveredPackets();
+    while (transfer.nextChunk < transfer.numChunks && numUndelivered < kStateTransferWindow)
     {
+        auto offset = static_cast<uint32_t>(transfer.nextChunk * kStateChunkSize);
+
         RequestStateResponseChunk chunk;
-        chunk.cookie = request.cookie;
-        chunk.index = index;
+        chunk.cookie = transfer.cookie;
+        chunk.index = transfer.nextChunk;
+        chunk.numChunks = transfer.numChunks;
+        chunk.totalSize = static_cast<uint32_t>(transfer.data.size());
         chunk.offset = offset;
-        chunk.dataSize = std::min<uint32_t>(kChunkSize, remaining - offset);
-        std::memcpy(chunk.data, reinterpret_cast<const uint8_t*>(ms.data()) + offset, chunk.dataSize);
+        chunk.dataSize = std::min<uint32_t>(kStateChunkSize, chunk.totalSize - offset);
+        std::memcpy(chunk.data, transfer.data.data() + offset, chunk.dataSize);
 
         client.connection->sendPacket(chunk);
 
-        offset += chunk.dataSize;
-        index++;
+        transfer.nextChunk++;
+        numUndelivered++;
+    }
+
+    if (transfer.nextChunk >= transfer.numChunks)
+    {
+        // Redelivery of the remaining chunks is left to the connection
+        client.stateTransfer.reset();
     }
 }
 
@@ -200,7 +242,8 @@ void NetworkServer::removedTimedOutClients()
         auto& client = *it;
         if (client->connection->hasTimedOut())
         {
-            Logging::info("Client timed out: %s", client->name);
+            auto stats = client->connection->getStats();
+            Logging::info("Client timed out: {} (round trip {} ms, {} resends, {} undelivered)", client->name, stats.roundTripTime, stats.numResends, stats.numUndeliveredPackets);
             it = _clients.erase(it);
         }
         else
@@ -297,6 +340,10 @@ void NetworkServer::updateClients()
 {
     for (auto& client : _clients)
     {
+        if (client->stateTransfer)
+        {
+            sendStateChunks(*client);
+        }
         client->connection->update();
     }
 }
@@ -5,16 +5,27 @@
 #include "NetworkConnection.h"
 #include "Socket.h"
 #include <mutex>
+#include <optional>
+#include <vector>
 
 namespace OpenLoco::Network
 {
     class NetworkConnection;
 
+    struct StateTransfer
+    {
+        uint32_t cookie{};
+        uint16_t numChunks{};
+        uint16_t nextChunk{};
+        std::vector<uint8_t> data;
+    };
+
     struct Client
     {
         client_id_t id{};
         std::unique_ptr<NetworkConnection> connection;
         std::string name;
+        std::optional<StateTransfer> stateTransfer;
     };
 
     struct ChatMessage
@@ -41,6 +52,7 @@ namespace OpenLoco::Network
         void createNewClient(std::unique_ptr<NetworkConnection> conn, const ConnectPacket& packet);
         void onReceivePacketFromClient(Client& client, const Packet& packet);
         void onReceiveStateRequestPacket(Client& client, const RequestStatePacket& packet);
+        void sendStateChunks(Client& client);
         void onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet);
         void onReceiveGameCommandPacket(Client& client, const GameCommandPacket& packet);
         void removedTimedOutClients();
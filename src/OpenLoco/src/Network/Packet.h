@@ -107,6 +107,7 @@ namespace OpenLoco::Network
         size_t size() const { return sizeof(RequestStateResponse); }
 
         uint32_t cookie{};
+        // Size of the transferred state, a sawyer chunk holding the S5 followed by ExtraState
         uint32_t totalSize{};
         uint16_t numChunks{};
     };
@@ -118,9 +119,12 @@ namespace OpenLoco::Network
 
         uint32_t cookie{};
         uint16_t index{};
+        // Repeated from RequestStateResponse so the receive buffer can be allocated by whichever arrives first
+        uint16_t numChunks{};
+        uint32_t totalSize{};
         uint32_t offset{};
         uint32_t dataSize{};
-        uint8_t data[kMaxPacketDataSize - 14]{};
+        uint8_t data[kMaxPacketDataSize - 20]{};
     };
     static_assert(sizeof(RequestStateResponseChunk) == kMaxPacketDataSize);
 
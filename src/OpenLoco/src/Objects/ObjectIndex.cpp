@@ -2,28 +2,36 @@
 #include "Environment.h"
 #include "Localisation/StringIds.h"
 #include "Localisation/StringManager.h"
+#include "Logging.h"
 #include "ObjectManager.h"
 #include "OpenLoco.h"
 #include "Ui.h"
 #include "Ui/ProgressBar.h"
+#include <OpenLoco/Core/ThreadPool.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/Numeric.hpp>
 #include <OpenLoco/Utility/Stream.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <fstream>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 
 using namespace OpenLoco::Interop;
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::ObjectManager
 {
     static loco_global<std::byte*, 0x0050D13C> _installedObjectList;
     static loco_global<uint32_t, 0x0112A110> _installedObjectCount;
     static loco_global<bool, 0x0112A17E> _customObjectsInIndex;
-    static loco_global<std::byte*, 0x0050D158> _dependentObjectsVector;
-    static loco_global<std::byte[0x2002], 0x0112A17F> _dependentObjectVectorData;
     static loco_global<bool, 0x0050AEAD> _isFirstTime;
-    static loco_global<bool, 0x0050D161> _isPartialLoaded;
     static loco_global<uint32_t, 0x009D9D52> _decodedSize;    // return of loadTemporaryObject (badly named)
     static loco_global<uint32_t, 0x0112A168> _numImages;      // return of loadTemporaryObject (badly named)
     static loco_global<uint8_t, 0x0112C211> _intelligence;    // return of loadTemporaryObject (badly named)
@@ -53,8 +61,97 @@ namespace OpenLoco::ObjectManager
         uint32_t numObjects; // duplicates ObjectFolderState.numObjects but without high 1 and includes corrupted .dat's
     };
     static_assert(sizeof(IndexHeader) == 0x14);
+
+    // Written after the index entries. Vanilla only reads up to IndexHeader::fileSize so ignores these.
+    struct FileRecordsHeader
+    {
+        uint32_t magic;
+        uint32_t numRecords;
+    };
+    static_assert(sizeof(FileRecordsHeader) == 0x8);
+    struct FileRecordData
+    {
+        int64_t lastWriteTime;
+        uint32_t fileSize;
+        // Followed by null terminated filename
+    };
+    static_assert(sizeof(FileRecordData) == 0xC);
 #pragma pack(pop)
 
+    static constexpr uint32_t kFileRecordsMagic = 0x3246494F; // "OIF2"
+
+    // State of a single DAT file at the time it was indexed
+    struct ObjectFileRecord
+    {
+        std::string filename;
+        int64_t lastWriteTime;
+        uint32_t fileSize;
+    };
+
+    // In memory lookup tables built over _installedObjectList so that lookups do not need
+    // to re-parse the variable length index entries.
+    struct ObjectIndexLookup
+    {
+        // The index the lookup was built from, used to detect a stale lookup
+        std::byte* installedObjectList = nullptr;
+        uint32_t installedObjectCount = 0;
+
+        std::vector<ObjectIndexEntry> entries;
+        std::array<std::vector<ObjectIndexId>, maxObjectTypes> entriesByType;
+        // Keyed by object name. Only type and name are hashed as ObjectHeader equality
+        // ignores the flags and checksum unless both headers are custom.
+        std::array<std::unordered_map<std::string_view, std::vector<ObjectIndexId>>, maxObjectTypes> entriesByName;
+    };
+
+    static ObjectIndexLookup _indexLookup;
+
+    static void clearIndexLookup()
+    {
+        _indexLookup.installedObjectList = nullptr;
+        _indexLookup.installedObjectCount = 0;
+        _indexLookup.entries.clear();
+        for (auto& typeEntries : _indexLookup.entriesByType)
+        {
+            typeEntries.clear();
+        }
+        for (auto& nameEntries : _indexLookup.entriesByName)
+        {
+            nameEntries.clear();
+        }
+    }
+
+    static void buildIndexLookup()
+    {
+        clearIndexLookup();
+
+        _indexLookup.entries.reserve(_installedObjectCount);
+        auto* ptr = *_installedObjectList;
+        for (ObjectIndexId i = 0; i < _installedObjectCount; i++)
+        {
+            const auto entry = ObjectIndexEntry::read(&ptr);
+            _indexLookup.entries.push_back(entry);
+
+            const auto type = static_cast<size_t>(entry._header->getType());
+            if (type >= maxObjectTypes)
+            {
+                continue;
+            }
+            _indexLookup.entriesByType[type].push_back(i);
+            _indexLookup.entriesByName[type][entry._header->getName()].push_back(i);
+        }
+
+        _indexLookup.installedObjectList = *_installedObjectList;
+        _indexLookup.installedObjectCount = _installedObjectCount;
+    }
+
+    // The lookup is invalid while an index is being created or if the index was changed by vanilla code
+    static bool isIndexLookupValid()
+    {
+        return _indexLookup.installedObjectList != nullptr
+            && _indexLookup.installedObjectList == *_installedObjectList
+            && _indexLookup.installedObjectCount == _installedObjectCount;
+    }
+
     // 0x00470F3C
     static ObjectFolderState getCurrentObjectFolderState()
     {
@@ -94,7 +191,7 @@ namespace OpenLoco::ObjectManager
         return false;
     }
 
-    static void saveIndex(const IndexHeader& header)
+    static void saveIndex(const IndexHeader& header, const std::vector<ObjectFileRecord>& records)
     {
         std::ofstream stream;
         const auto indexPath = Environment::getPathNoWarning(Environment::PathId::plugin1);
@@ -105,52 +202,41 @@ namespace OpenLoco::ObjectManager
         }
         stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
         stream.write(reinterpret_cast<const char*>(*_installedObjectList), header.fileSize);
+
+        const FileRecordsHeader recordsHeader{ kFileRecordsMagic, static_cast<uint32_t>(records.size()) };
+        stream.write(reinterpret_cast<const char*>(&recordsHeader), sizeof(recordsHeader));
+        for (const auto& record : records)
+        {
+            const FileRecordData recordData{ record.lastWriteTime, record.fileSize };
+            stream.write(reinterpret_cast<const char*>(&recordData), sizeof(recordData));
+            stream.write(record.filename.c_str(), record.filename.size() + 1);
+        }
     }
 
-    static std::pair<ObjectIndexEntry, size_t> createPartialNewEntry(std::byte* entryBuffer, const ObjectHeader& objHeader, const fs::path filename)
+    // Lists all DAT files in the object folder
+    static std::vector<ObjectFileRecord> scanObjectFolder()
     {
-        ObjectIndexEntry entry{};
-        size_t newEntrySize = 0;
-
-        // Header
-        std::memcpy(&entryBuffer[newEntrySize], &objHeader, sizeof(objHeader));
-        entry._header = reinterpret_cast<ObjectHeader*>(&entryBuffer[newEntrySize]);
-        newEntrySize += sizeof(objHeader);
-
-        // Filename
-        std::strcpy(reinterpret_cast<char*>(&entryBuffer[newEntrySize]), filename.u8string().c_str());
-        entry._filename = reinterpret_cast<char*>(&entryBuffer[newEntrySize]);
-        newEntrySize += strlen(reinterpret_cast<char*>(&entryBuffer[newEntrySize])) + 1;
-
-        // Header2 NULL
-        ObjectHeader2 objHeader2;
-        objHeader2.decodedFileSize = std::numeric_limits<uint32_t>::max();
-        std::memcpy(&entryBuffer[newEntrySize], &objHeader2, sizeof(objHeader2));
-        newEntrySize += sizeof(objHeader2);
-
-        // Name NULL
-        entryBuffer[newEntrySize] = std::byte(0);
-        entry._name = reinterpret_cast<char*>(&entryBuffer[newEntrySize]);
-        newEntrySize += strlen(reinterpret_cast<char*>(&entryBuffer[newEntrySize])) + 1;
-
-        // Header3 NULL
-        ObjectHeader3 objHeader3{};
-        std::memcpy(&entryBuffer[newEntrySize], &objHeader3, sizeof(objHeader3));
-        newEntrySize += sizeof(objHeader3);
-
-        // ObjectList1
-        const uint8_t size1 = 0;
-        entryBuffer[newEntrySize++] = std::byte(size1);
-
-        // ObjectList2
-        const uint8_t size2 = 0;
-        entryBuffer[newEntrySize++] = std::byte(size2);
-
-        return std::make_pair(entry, newEntrySize);
+        std::vector<ObjectFileRecord> records;
+        const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
+        for (const auto& file : fs::directory_iterator(objectPath, fs::directory_options::skip_permission_denied))
+        {
+            if (!file.is_regular_file())
+            {
+                continue;
+            }
+            const auto extension = file.path().extension().u8string();
+            if (!Utility::iequals(extension, ".DAT"))
+            {
+                continue;
+            }
+            const auto lastWrite = file.last_write_time().time_since_epoch().count();
+            records.push_back(ObjectFileRecord{ file.path().filename().u8string(), static_cast<int64_t>(lastWrite), static_cast<uint32_t>(file.file_size()) });
+        }
+        return records;
     }
 
     // TODO: Take an ObjectHeader2 & ObjectHeader3 from loadTemporary
-    static std::pair<ObjectIndexEntry, size_t> createNewEntry(std::byte* entryBuffer, const ObjectHeader& objHeader, const fs::path filename)
+    static std::pair<ObjectIndexEntry, size_t> createNewEntry(std::byte* entryBuffer, const ObjectHeader& objHeader, const fs::path filename, const DependentObjects& dependencies)
     {
         ObjectIndexEntry entry{};
         size_t newEntrySize = 0;
@@ -185,89 +271,51 @@ namespace OpenLoco::ObjectManager
         std::memcpy(&entryBuffer[newEntrySize], &objHeader3, sizeof(objHeader3));
         newEntrySize += sizeof(objHeader3);
 
-        auto* ptr = &_dependentObjectVectorData[0];
-
         // ObjectList1 (required objects)
-        const uint8_t size1 = uint8_t(*ptr++);
+        const uint8_t size1 = static_cast<uint8_t>(dependencies.required.size());
         entryBuffer[newEntrySize++] = std::byte(size1);
-        std::memcpy(&entryBuffer[newEntrySize], ptr, sizeof(ObjectHeader) * size1);
+        std::memcpy(&entryBuffer[newEntrySize], dependencies.required.data(), sizeof(ObjectHeader) * size1);
         newEntrySize += sizeof(ObjectHeader) * size1;
-        ptr += sizeof(ObjectHeader) * size1;
 
         // ObjectList2 (also loads objects {used for category selection})
-        const uint8_t size2 = uint8_t(*ptr++);
+        const uint8_t size2 = static_cast<uint8_t>(dependencies.willLoad.size());
         entryBuffer[newEntrySize++] = std::byte(size2);
-        std::memcpy(&entryBuffer[newEntrySize], ptr, sizeof(ObjectHeader) * size2);
+        std::memcpy(&entryBuffer[newEntrySize], dependencies.willLoad.data(), sizeof(ObjectHeader) * size2);
         newEntrySize += sizeof(ObjectHeader) * size2;
-        ptr += sizeof(ObjectHeader) * size2;
 
         return std::make_pair(entry, newEntrySize);
     }
 
-    // Adds a new object to the index by: 1. creating a partial index, 2. validating, 3. creating a full index entry
-    static void addObjectToIndex(const fs::path filepath, size_t& usedBufferSize)
+    struct NewIndexEntry
     {
-        ObjectHeader objHeader{};
-        {
-            std::ifstream stream;
-            stream.open(filepath, std::ios::in | std::ios::binary);
-            Utility::readData(stream, objHeader);
-            if (stream.gcount() != sizeof(objHeader))
-            {
-                return;
-            }
-        }
-
-        const auto curObjPos = usedBufferSize;
-        const auto partialNewEntry = createPartialNewEntry(&_installedObjectList[usedBufferSize], objHeader, filepath.filename());
-        usedBufferSize += partialNewEntry.second;
-        _installedObjectCount++;
-
-        _isPartialLoaded = true;
-        _dependentObjectsVector = _dependentObjectVectorData;
-        const bool tempLoadFailed = loadTemporaryObject(objHeader);
-        _dependentObjectsVector = reinterpret_cast<std::byte*>(-1);
-        _isPartialLoaded = false;
-        _installedObjectCount--;
-        // Rewind as it is only a partial object loaded
-        usedBufferSize = curObjPos;
+        std::string name;
+        std::vector<std::byte> data;
+    };
 
-        if (!tempLoadFailed)
+    // Loads a decoded object file as the temporary object to read its metadata and creates its index entry
+    static std::optional<NewIndexEntry> createIndexEntry(const ObjectFile& objectFile, const fs::path& filename)
+    {
+        DependentObjects dependencies;
+        if (!loadTemporaryObject(objectFile, dependencies))
         {
-            return;
+            return std::nullopt;
         }
 
-        // Load full entry into temp buffer.
         // 0x009D1CC8
         std::byte newEntryBuffer[0x2000] = {};
-        const auto [newEntry, newEntrySize] = createNewEntry(newEntryBuffer, objHeader, filepath.filename());
+        const auto [newEntry, newEntrySize] = createNewEntry(newEntryBuffer, objectFile.header, filename, dependencies);
 
         freeTemporaryObject();
 
-        auto* indexPtr = *_installedObjectList;
-        // This ptr will be pointing at where in the object list to install the new entry
-        auto* installPtr = indexPtr;
-        for (uint32_t i = 0; i < _installedObjectCount; i++)
-        {
-            auto entry = ObjectIndexEntry::read(&indexPtr);
-            if (strcmp(newEntry._name, entry._name) < 0)
-            {
-                break;
-            }
-            // If cmp < 0 then we will want to install at the previous indexPtr location
-            installPtr = indexPtr;
-        }
-
-        auto moveSize = usedBufferSize - (installPtr - *_installedObjectList);
-        std::memmove(installPtr + newEntrySize, installPtr, moveSize);
-        std::memcpy(installPtr, newEntryBuffer, newEntrySize);
-        usedBufferSize += newEntrySize;
-
-        _installedObjectCount++;
+        return NewIndexEntry{ newEntry._name, std::vector<std::byte>(newEntryBuffer, newEntryBuffer + newEntrySize) };
     }
 
-    // 0x0047118B
-    static void createIndex(const ObjectFolderState& currentState)
+    // Loads the object files in recordsToLoad and merges them with the already created entries
+    // into a new index. entries holds one slot per record so that the result is the same as
+    // loading every record in folder order. Object files are read, decoded and checksummed on a
+    // thread pool in batches. Loading an object to fetch its name and metadata uses global state
+    // so that part is serial.
+    static void buildIndex(const ObjectFolderState& currentState, const std::vector<ObjectFileRecord>& records, const std::vector<size_t>& recordsToLoad, std::vector<std::optional<NewIndexEntry>>&& entries)
     {
         Ui::processMessagesMini();
         const auto progressString = _isFirstTime ? StringIds::starting_for_the_first_time : StringIds::checking_object_files;
@@ -275,117 +323,236 @@ namespace OpenLoco::ObjectManager
 
         // Reset
         reloadAll();
+        clearIndexLookup();
         if (reinterpret_cast<int32_t>(*_installedObjectList) != -1)
         {
             free(*_installedObjectList);
-        }
-
-        // Prepare initial object list buffer (we will grow this as required)
-        size_t bufferSize = 0x4000;
-        _installedObjectList = static_cast<std::byte*>(malloc(bufferSize));
-        if (_installedObjectList == nullptr)
-        {
             _installedObjectList = reinterpret_cast<std::byte*>(-1);
-            exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
-            return;
         }
-
         _installedObjectCount = 0;
-        // Create new index by iterating all DAT files and processing
-        IndexHeader header{};
-        uint8_t progress = 0;      // Progress is used for the ProgressBar Ui element
-        size_t usedBufferSize = 0; // Keep track of used space to allow for growth and for final sizing
+
         const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
-        for (const auto& file : fs::directory_iterator(objectPath, fs::directory_options::skip_permission_denied))
+        auto& pool = Core::ThreadPool::getShared();
+        const auto mainThreadId = std::this_thread::get_id();
+        // Limits how many decoded objects are held in memory at once
+        const size_t batchSize = pool.size() * 8;
+
+        std::vector<std::optional<ObjectFile>> batch;
+        uint8_t progress = 0; // Progress is used for the ProgressBar Ui element
+        std::atomic<size_t> numProcessed{};
+        for (size_t batchStart = 0; batchStart < recordsToLoad.size(); batchStart += batchSize)
         {
-            if (!file.is_regular_file())
-            {
-                continue;
-            }
-            const auto extension = file.path().extension().u8string();
-            if (!Utility::iequals(extension, ".DAT"))
-            {
-                continue;
-            }
-            Ui::processMessagesMini();
-            header.state.numObjects++;
+            const auto batchCount = std::min(batchSize, recordsToLoad.size() - batchStart);
+            batch.clear();
+            batch.resize(batchCount);
 
-            // Cheap calculation of (curObjectCount / totalObjectCount) * 256
-            const auto newProgress = (header.state.numObjects << 8) / ((currentState.numObjects & 0xFFFFFF) + 1);
-            if (progress != newProgress)
-            {
-                progress = newProgress;
-                Ui::ProgressBar::setProgress(newProgress);
-            }
+            pool.parallelFor(batchCount, [&](size_t i) {
+                const auto& record = records[recordsToLoad[batchStart + i]];
+                batch[i] = readObjectFile(objectPath / fs::u8path(record.filename));
+                numProcessed++;
 
-            // Grow object list buffer if near limit
-            const auto remainingBuffer = bufferSize - usedBufferSize;
-            if (remainingBuffer < 0x231E)
-            {
-                // Original grew buffer at slower rate. Memory is cheap though
-                bufferSize *= 2;
-                _installedObjectList = static_cast<std::byte*>(realloc(*_installedObjectList, bufferSize));
-                if (_installedObjectList == nullptr)
+                if (std::this_thread::get_id() != mainThreadId)
                 {
-                    exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
                     return;
                 }
+
+                // Cheap calculation of (curObjectCount / totalObjectCount) * 256
+                const auto newProgress = static_cast<uint8_t>((numProcessed << 8) / (recordsToLoad.size() + 1));
+                if (progress != newProgress)
+                {
+                    progress = newProgress;
+                    Ui::ProgressBar::setProgress(newProgress);
+                }
+                Ui::processMessagesMini();
+            });
+
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                if (!batch[i].has_value())
+                {
+                    continue;
+                }
+                const auto recordIndex = recordsToLoad[batchStart + i];
+                entries[recordIndex] = createIndexEntry(*batch[i], fs::u8path(records[recordIndex].filename));
+            }
+        }
+
+        std::vector<NewIndexEntry> newEntries;
+        for (auto& entry : entries)
+        {
+            if (entry.has_value())
+            {
+                newEntries.push_back(std::move(*entry));
             }
+        }
+
+        // Index is sorted by name, objects with the same name are kept in folder order
+        std::stable_sort(std::begin(newEntries), std::end(newEntries), [](const NewIndexEntry& lhs, const NewIndexEntry& rhs) {
+            return lhs.name < rhs.name;
+        });
+
+        size_t usedBufferSize = 0;
+        for (const auto& entry : newEntries)
+        {
+            usedBufferSize += entry.data.size();
+        }
+
+        _installedObjectList = static_cast<std::byte*>(malloc(std::max<size_t>(usedBufferSize, 1)));
+        if (_installedObjectList == nullptr)
+        {
+            _installedObjectList = reinterpret_cast<std::byte*>(-1);
+            exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
+            return;
+        }
 
-            addObjectToIndex(file.path(), usedBufferSize);
+        auto* installPtr = *_installedObjectList;
+        for (const auto& entry : newEntries)
+        {
+            std::memcpy(installPtr, entry.data.data(), entry.data.size());
+            installPtr += entry.data.size();
         }
+        _installedObjectCount = static_cast<uint32_t>(newEntries.size());
 
         // New index creation completed. Reset and save result.
         reloadAll();
+        IndexHeader header{};
         header.fileSize = usedBufferSize;
         header.numObjects = _installedObjectCount;
         header.state = currentState;
-        saveIndex(header);
+        saveIndex(header, records);
 
         Ui::ProgressBar::end();
     }
 
-    static bool tryLoadIndex(const ObjectFolderState& currentState)
+    // 0x0047118B
+    static void createIndex(const ObjectFolderState& currentState)
+    {
+        const auto records = scanObjectFolder();
+        std::vector<size_t> recordsToLoad(records.size());
+        std::iota(std::begin(recordsToLoad), std::end(recordsToLoad), 0);
+        buildIndex(currentState, records, recordsToLoad, std::vector<std::optional<NewIndexEntry>>(records.size()));
+    }
+
+    struct IndexFile
+    {
+        IndexHeader header;
+        std::vector<std::byte> entries;
+        std::optional<std::vector<ObjectFileRecord>> records; // Not present in indexes written by vanilla
+    };
+
+    static std::optional<IndexFile> readIndexFile()
     {
         const auto indexPath = Environment::getPathNoWarning(Environment::PathId::plugin1);
         if (!fs::exists(indexPath))
         {
-            return false;
+            return std::nullopt;
         }
         std::ifstream stream;
         stream.open(indexPath, std::ios::in | std::ios::binary);
         if (!stream.is_open())
         {
-            return false;
+            return std::nullopt;
         }
         // 0x00112A14C -> 160
-        IndexHeader header{};
-        Utility::readData(stream, header);
-        if ((header.state != currentState) || (stream.gcount() != sizeof(header)))
+        IndexFile index{};
+        Utility::readData(stream, index.header);
+        if (stream.gcount() != sizeof(index.header))
         {
-            return false;
+            return std::nullopt;
         }
-        else
+        index.entries.resize(index.header.fileSize);
+        Utility::readData(stream, index.entries.data(), index.header.fileSize);
+        if (stream.gcount() != static_cast<int32_t>(index.header.fileSize))
+        {
+            return std::nullopt;
+        }
+
+        FileRecordsHeader recordsHeader{};
+        Utility::readData(stream, recordsHeader);
+        if (stream.gcount() != sizeof(recordsHeader) || recordsHeader.magic != kFileRecordsMagic)
         {
-            if (reinterpret_cast<int32_t>(*_installedObjectList) != -1)
+            return index;
+        }
+        std::vector<ObjectFileRecord> records;
+        records.reserve(recordsHeader.numRecords);
+        for (uint32_t i = 0; i < recordsHeader.numRecords; i++)
+        {
+            FileRecordData recordData{};
+            Utility::readData(stream, recordData);
+            std::string filename;
+            std::getline(stream, filename, '\0');
+            if (!stream)
             {
-                free(*_installedObjectList);
+                return index;
             }
-            _installedObjectList = static_cast<std::byte*>(malloc(header.fileSize));
-            if (_installedObjectList == nullptr)
+            records.push_back(ObjectFileRecord{ std::move(filename), recordData.lastWriteTime, recordData.fileSize });
+        }
+        index.records = std::move(records);
+        return index;
+    }
+
+    static void installIndex(const IndexFile& index)
+    {
+        clearIndexLookup();
+        if (reinterpret_cast<int32_t>(*_installedObjectList) != -1)
+        {
+            free(*_installedObjectList);
+        }
+        _installedObjectList = static_cast<std::byte*>(malloc(std::max<size_t>(index.header.fileSize, 1)));
+        if (_installedObjectList == nullptr)
+        {
+            exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
+            return;
+        }
+        std::memcpy(*_installedObjectList, index.entries.data(), index.header.fileSize);
+        _installedObjectCount = index.header.numObjects;
+        reloadAll();
+    }
+
+    // Reuses the entries of files that are unchanged since the index was written and only loads
+    // new or changed files. Entries of deleted files are dropped.
+    static void updateIndex(const ObjectFolderState& currentState, const IndexFile& index)
+    {
+        std::unordered_map<std::string_view, const ObjectFileRecord*> oldRecords;
+        for (const auto& record : *index.records)
+        {
+            oldRecords[record.filename] = &record;
+        }
+
+        std::unordered_map<std::string_view, NewIndexEntry> oldEntries;
+        auto* ptr = const_cast<std::byte*>(index.entries.data());
+        for (uint32_t i = 0; i < index.header.numObjects; i++)
+        {
+            auto* entryStart = ptr;
+            const auto entry = ObjectIndexEntry::read(&ptr);
+            oldEntries.emplace(entry._filename, NewIndexEntry{ entry._name, std::vector<std::byte>(entryStart, ptr) });
+        }
+
+        const auto records = scanObjectFolder();
+        std::vector<size_t> recordsToLoad;
+        std::vector<std::optional<NewIndexEntry>> entries(records.size());
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            const auto& record = records[i];
+            const auto oldRecord = oldRecords.find(record.filename);
+            if (oldRecord == oldRecords.end()
+                || oldRecord->second->fileSize != record.fileSize
+                || oldRecord->second->lastWriteTime != record.lastWriteTime)
             {
-                exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
-                return false;
+                recordsToLoad.push_back(i);
+                continue;
             }
-            Utility::readData(stream, *_installedObjectList, header.fileSize);
-            if (stream.gcount() != static_cast<int32_t>(header.fileSize))
+
+            // Unchanged files without an entry previously failed to load so are skipped
+            auto oldEntry = oldEntries.find(record.filename);
+            if (oldEntry != oldEntries.end())
             {
-                return false;
+                entries[i] = std::move(oldEntry->second);
             }
-            _installedObjectCount = header.numObjects;
-            reloadAll();
         }
-        return true;
+
+        Logging::info("Updating object index: {} new or changed files, {} unchanged files", recordsToLoad.size(), records.size() - recordsToLoad.size());
+        buildIndex(currentState, records, recordsToLoad, std::move(entries));
     }
 
     // 0x00470F3C
@@ -394,11 +561,21 @@ namespace OpenLoco::ObjectManager
         // 0x00112A138 -> 144
         const auto currentState = getCurrentObjectFolderState();
 
-        if (!tryLoadIndex(currentState))
+        const auto index = readIndexFile();
+        if (index.has_value() && index->header.state == currentState)
+        {
+            installIndex(*index);
+        }
+        else if (index.has_value() && index->records.has_value())
+        {
+            updateIndex(currentState, *index);
+        }
+        else
         {
             createIndex(currentState);
         }
 
+        buildIndexLookup();
         _customObjectsInIndex = hasCustomObjectsInIndex();
     }
 
@@ -407,7 +584,7 @@ namespace OpenLoco::ObjectManager
         return *_installedObjectCount;
     }
 
-    std::vector<std::pair<ObjectIndexId, ObjectIndexEntry>> getAvailableObjects(ObjectType type)
+    static std::vector<std::pair<ObjectIndexId, ObjectIndexEntry>> getAvailableObjectsSlow(ObjectType type)
     {
         auto ptr = (std::byte*)_installedObjectList;
         std::vector<std::pair<ObjectIndexId, ObjectIndexEntry>> list;
@@ -422,15 +599,55 @@ namespace OpenLoco::ObjectManager
         return list;
     }
 
+    std::vector<std::pair<ObjectIndexId, ObjectIndexEntry>> getAvailableObjects(ObjectType type)
+    {
+        const auto typeIndex = static_cast<size_t>(type);
+        if (!isIndexLookupValid() || typeIndex >= maxObjectTypes)
+        {
+            return getAvailableObjectsSlow(type);
+        }
+
+        const auto& typeEntries = _indexLookup.entriesByType[typeIndex];
+        std::vector<std::pair<ObjectIndexId, ObjectIndexEntry>> list;
+        list.reserve(typeEntries.size());
+        for (const auto id : typeEntries)
+        {
+            list.emplace_back(id, _indexLookup.entries[id]);
+        }
+
+        return list;
+    }
+
     std::optional<ObjectIndexEntry> findObjectInIndex(const ObjectHeader& objectHeader)
     {
-        const auto objects = getAvailableObjects(objectHeader.getType());
-        auto res = std::find_if(std::begin(objects), std::end(objects), [&objectHeader](auto& obj) { return *obj.second._header == objectHeader; });
-        if (res == std::end(objects))
+        const auto typeIndex = static_cast<size_t>(objectHeader.getType());
+        if (!isIndexLookupValid() || typeIndex >= maxObjectTypes)
+        {
+            // Slow path used while the index is being created as partial entries are looked up
+            const auto objects = getAvailableObjectsSlow(objectHeader.getType());
+            auto res = std::find_if(std::begin(objects), std::end(objects), [&objectHeader](auto& obj) { return *obj.second._header == objectHeader; });
+            if (res == std::end(objects))
+            {
+                return std::nullopt;
+            }
+            return res->second;
+        }
+
+        const auto& nameEntries = _indexLookup.entriesByName[typeIndex];
+        const auto res = nameEntries.find(objectHeader.getName());
+        if (res == nameEntries.end())
         {
             return std::nullopt;
         }
-        return res->second;
+        for (const auto id : res->second)
+        {
+            const auto& entry = _indexLookup.entries[id];
+            if (*entry._header == objectHeader)
+            {
+                return entry;
+            }
+        }
+        return std::nullopt;
     }
 
     bool isObjectInstalled(const ObjectHeader& objectHeader)
@@ -21,6 +21,7 @@
 #include "Localisation/Formatting.h"
 #include "Localisation/StringIds.h"
 #include "Logging.h"
+#include "Map/TileManager.h"
 #include "ObjectImageTable.h"
 #include "ObjectIndex.h"
 #include "ObjectStringTable.h"
@@ -330,6 +331,9 @@ namespace OpenLoco::ObjectManager
                 }
             }
         }
+
+        // Which surfaces are desert depends on the land objects
+        World::TileManager::invalidateAllSurfaceCounts();
     }
 
     // 0x00472754
@@ -368,6 +372,7 @@ namespace OpenLoco::ObjectManager
         if (_temporaryObject != nullptr && _temporaryObject != reinterpret_cast<Object*>(-1))
         {
             free(_temporaryObject);
+            Gfx::invalidateImageExtentsCache();
             // For vanilla compatibility set as -1. Replace with nullptr when all users of temporaryObject implemented.
             _temporaryObject = reinterpret_cast<Object*>(-1);
         }
@@ -434,6 +439,22 @@ namespace OpenLoco::ObjectManager
         return preLoadObj;
     }
 
+    // Loads a pre loaded object as the temporary object. Takes ownership of preLoadObj.object
+    static void loadTemporaryObject(const PreLoadedObject& preLoadObj, DependentObjects* dependencies)
+    {
+        const uint32_t oldNumImages = getTotalNumImages();
+        setTotalNumImages(Gfx::G1ExpectedCount::kDisc);
+        _temporaryObject = preLoadObj.object;
+        _isPartialLoaded = true;
+        _isTemporaryObject = 0xFF;
+        callObjectLoad({ preLoadObj.header.getType(), 0 }, *preLoadObj.object, preLoadObj.objectData, dependencies);
+        _isTemporaryObject = 0;
+        _isPartialLoaded = false;
+
+        _numImages = getTotalNumImages() - Gfx::G1ExpectedCount::kDisc;
+        setTotalNumImages(oldNumImages);
+    }
+
     // 0x0047176D
     // TODO: Return a std::unique_ptr and a ObjectHeader3 & ObjectHeader2 for the metadata
     bool loadTemporaryObject(ObjectHeader& header)
@@ -444,14 +465,9 @@ namespace OpenLoco::ObjectManager
             return false;
         }
 
-        const uint32_t oldNumImages = getTotalNumImages();
-        setTotalNumImages(Gfx::G1ExpectedCount::kDisc);
-        _temporaryObject = preLoadObj->object;
-        _isPartialLoaded = true;
-        _isTemporaryObject = 0xFF;
         auto* depObjs = Interop::addr<0x0050D158, uint8_t*>();
         DependentObjects dependencies;
-        callObjectLoad({ preLoadObj->header.getType(), 0 }, *preLoadObj->object, preLoadObj->objectData, depObjs != reinterpret_cast<uint8_t*>(0xFFFFFFFF) ? &dependencies : nullptr);
+        loadTemporaryObject(*preLoadObj, depObjs != reinterpret_cast<uint8_t*>(0xFFFFFFFF) ? &dependencies : nullptr);
         if (depObjs != reinterpret_cast<uint8_t*>(0xFFFFFFFF))
         {
             *depObjs++ = static_cast<uint8_t>(dependencies.required.size());
@@ -466,14 +482,61 @@ namespace OpenLoco::ObjectManager
                 std::copy(dependencies.willLoad.begin(), dependencies.willLoad.end(), reinterpret_cast<ObjectHeader*>(depObjs));
             }
         }
-        _isTemporaryObject = 0;
-        _isPartialLoaded = false;
+        return true;
+    }
 
-        _numImages = getTotalNumImages() - Gfx::G1ExpectedCount::kDisc;
-        setTotalNumImages(oldNumImages);
+    bool loadTemporaryObject(const ObjectFile& objectFile, DependentObjects& dependencies)
+    {
+        // Copy the object into Loco freeable memory (required for when load loads the object)
+        auto* object = reinterpret_cast<Object*>(malloc(objectFile.data.size()));
+        if (object == nullptr)
+        {
+            return false;
+        }
+        std::copy(std::begin(objectFile.data), std::end(objectFile.data), reinterpret_cast<std::byte*>(object));
+
+        PreLoadedObject preLoadObj{};
+        preLoadObj.objectData = stdx::span<std::byte>(reinterpret_cast<std::byte*>(object), objectFile.data.size());
+        preLoadObj.object = object;
+        preLoadObj.header = objectFile.header;
+        _decodedSize = preLoadObj.objectData.size();
+
+        loadTemporaryObject(preLoadObj, &dependencies);
         return true;
     }
 
+    std::optional<ObjectFile> readObjectFile(const fs::path& path)
+    {
+        try
+        {
+            SawyerStreamReader stream(path);
+            ObjectFile objectFile{};
+            stream.read(&objectFile.header, sizeof(objectFile.header));
+            if (static_cast<size_t>(objectFile.header.getType()) >= maxObjectTypes)
+            {
+                return std::nullopt;
+            }
+
+            const auto data = stream.readChunk();
+            if (data.empty() || !computeObjectChecksum(objectFile.header, data))
+            {
+                return std::nullopt;
+            }
+
+            objectFile.data.resize(data.size());
+            std::copy(std::begin(data), std::end(data), reinterpret_cast<uint8_t*>(objectFile.data.data()));
+            if (!callObjectValidate(objectFile.header.getType(), *reinterpret_cast<Object*>(objectFile.data.data())))
+            {
+                return std::nullopt;
+            }
+            return objectFile;
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
     Object* getTemporaryObject()
     {
         Object* obj = _temporaryObject;
@@ -542,6 +605,7 @@ namespace OpenLoco::ObjectManager
         }
         unload(*handle);
         free(_objectRepository[enumValue(handle->type)].objects[handle->id]);
+        Gfx::invalidateImageExtentsCache();
         _objectRepository[enumValue(handle->type)].objects[handle->id] = reinterpret_cast<Object*>(-1);
     }
 
@@ -806,6 +870,7 @@ namespace OpenLoco::ObjectManager
     void unloadAll()
     {
         call(0x00472031);
+        Gfx::invalidateImageExtentsCache();
     }
 
     void unload(const LoadedObjectHandle& handle)
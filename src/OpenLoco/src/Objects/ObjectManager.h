@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Object.h"
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <OpenLoco/Core/Span.hpp>
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <optional>
@@ -151,8 +152,18 @@ namespace OpenLoco::ObjectManager
         std::vector<ObjectHeader> willLoad;
     };
 
+    // An object file that has been decoded, checksummed and validated but not loaded
+    struct ObjectFile
+    {
+        ObjectHeader header;
+        std::vector<std::byte> data;
+    };
+
     void freeTemporaryObject();
     bool loadTemporaryObject(ObjectHeader& header);
+    bool loadTemporaryObject(const ObjectFile& objectFile, DependentObjects& dependencies);
+    // Does not touch any global object state so is safe to call from worker threads
+    std::optional<ObjectFile> readObjectFile(const fs::path& path);
     Object* getTemporaryObject();
     bool isTemporaryObjectLoad();
 
@@ -62,6 +62,7 @@
 #include "S5/S5.h"
 #include "ScenarioManager.h"
 #include "SceneManager.h"
+#include "TickProfiler.h"
 #include "Title.h"
 #include "Tutorial.h"
 #include "Ui.h"
@@ -770,28 +771,33 @@ namespace OpenLoco
         if (!Network::shouldProcessTick(ScenarioManager::getScenarioTicks() + 1))
             return;
 
+        using TickProfiler::Stage;
+        TickProfiler::ScopedStage tickStage(Stage::tick);
+
         ScenarioManager::setScenarioTicks(ScenarioManager::getScenarioTicks() + 1);
         ScenarioManager::setScenarioTicks2(ScenarioManager::getScenarioTicks2() + 1);
-        Network::processGameCommands(ScenarioManager::getScenarioTicks());
+        TickProfiler::measure(Stage::gameCommands, [] { Network::processGameCommands(ScenarioManager::getScenarioTicks()); });
 
         recordTickStartPrng();
-        call(0x004613F0); // Map::TileManager::reorg?
+        TickProfiler::measure(Stage::tileReorganise, [] { call(0x004613F0); }); // Map::TileManager::reorg?
         addr<0x00F25374, uint8_t>() = S5::getOptions().madeAnyChanges;
-        dateTick();
-        World::TileManager::update();
-        World::WaveManager::update();
-        TownManager::update();
-        IndustryManager::update();
-        VehicleManager::update();
+        TickProfiler::measure(Stage::dateTick, dateTick);
+        TickProfiler::measure(Stage::tileManager, World::TileManager::update);
+        TickProfiler::measure(Stage::waveManager, World::WaveManager::update);
+        TickProfiler::measure(Stage::townManager, TownManager::update);
+        TickProfiler::measure(Stage::industryManager, IndustryManager::update);
+        TickProfiler::measure(Stage::vehicleManager, VehicleManager::update);
         sub_46FFCA();
-        StationManager::update();
-        EffectsManager::update();
+        TickProfiler::measure(Stage::stationManager, StationManager::update);
+        TickProfiler::measure(Stage::effectsManager, EffectsManager::update);
         sub_46FFCA();
-        CompanyManager::update();
-        World::AnimationManager::update();
-        Audio::updateVehicleNoise();
-        Audio::updateAmbientNoise();
-        Title::update();
+        TickProfiler::measure(Stage::companyManager, CompanyManager::update);
+        TickProfiler::measure(Stage::animationManager, World::AnimationManager::update);
+        TickProfiler::measure(Stage::audio, [] {
+            Audio::updateVehicleNoise();
+            Audio::updateAmbientNoise();
+        });
+        TickProfiler::measure(Stage::title, Title::update);
 
         S5::getOptions().madeAnyChanges = addr<0x00F25374, uint8_t>();
         if (_50C197 != 0)
@@ -1109,34 +1115,37 @@ namespace OpenLoco
         _glpCmdLine = "";
     }
 
-    void simulateGame(const fs::path& path, int32_t ticks)
+    bool simulateGame(const fs::path& path, int32_t ticks)
     {
         Config::read();
         Environment::resolvePaths();
         resetCmdline();
         registerHooks();
 
+        // A successful load always ends by interrupting, so returning normally means it failed
         try
         {
             initialise();
             loadFile(path);
+            Logging::error("Unable to simulate park!");
+            return false;
         }
         catch (const std::exception& e)
         {
             Logging::error("Unable to simulate park: {}", e.what());
+            return false;
         }
         catch (const GameException i)
         {
             if (i != GameException::Interrupt)
             {
                 Logging::error("Unable to simulate park!");
+                return false;
             }
-            else
-            {
-                Logging::info("File loaded. Starting simulation.");
-            }
+            Logging::info("File loaded. Starting simulation.");
         }
         tickLogic(ticks);
+        return true;
     }
 
     // 0x00406D13
@@ -22,7 +22,7 @@ namespace OpenLoco
 
     void* hInstance();
     void initialiseViewports();
-    void simulateGame(const fs::path& path, int32_t ticks);
+    bool simulateGame(const fs::path& path, int32_t ticks);
 
     void sub_431695(uint16_t var_F253A0);
     int main(int argc, const char** argv);
@@ -25,6 +25,33 @@ namespace OpenLoco::Paint
 {
     PaintSession _session;
 
+    // Paint structs are allocated from this arena rather than the original fixed array of 4000
+    // entries. It grows by a chunk whenever a column fills it and is kept for the next frames.
+    constexpr size_t kPaintArenaChunkSize = 4000;
+    static std::vector<uint8_t> _paintArena; // PaintEntry is not default constructible
+    static PaintArenaStats _paintArenaStats;
+
+    static PaintEntry* getPaintArenaBegin()
+    {
+        return reinterpret_cast<PaintEntry*>(_paintArena.data());
+    }
+
+    static PaintEntry* getPaintArenaEnd()
+    {
+        return reinterpret_cast<PaintEntry*>(_paintArena.data() + _paintArena.size());
+    }
+
+    static void growPaintArena()
+    {
+        _paintArena.resize(_paintArena.size() + kPaintArenaChunkSize * sizeof(PaintEntry));
+        _paintArenaStats.capacity = static_cast<uint32_t>(_paintArena.size() / sizeof(PaintEntry));
+    }
+
+    const PaintArenaStats& getPaintArenaStats()
+    {
+        return _paintArenaStats;
+    }
+
     void PaintSession::setEntityPosition(const World::Pos2& pos)
     {
         _spritePositionX = pos.x;
@@ -325,9 +352,15 @@ namespace OpenLoco::Paint
 
     void PaintSession::init(Gfx::RenderTarget& rt, const SessionOptions& options)
     {
+        if (_paintArena.empty())
+        {
+            growPaintArena();
+        }
+
         _renderTarget = &rt;
-        _nextFreePaintStruct = &_paintEntries[0];
-        _endOfPaintStructArray = &_paintEntries[3998];
+        _nextFreePaintStruct = getPaintArenaBegin();
+        // Leaves room for the head struct added by arrangeStructs
+        _endOfPaintStructArray = getPaintArenaEnd() - 2;
         _lastPS = nullptr;
         for (auto& quadrant : _quadrants)
         {
@@ -531,21 +564,50 @@ namespace OpenLoco::Paint
         if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
             return;
 
-        currentRotation = Ui::WindowManager::getCurrentRotation();
-        switch (currentRotation)
+        // The original game sets up its own session when it calls into generate
+        const bool usesArena = !_paintArena.empty()
+            && *_nextFreePaintStruct >= getPaintArenaBegin()
+            && *_nextFreePaintStruct < getPaintArenaEnd();
+
+        for (;;)
         {
-            case 0:
-                generateTilesAndEntities(generateParameters<0>(getRenderTarget()));
-                break;
-            case 1:
-                generateTilesAndEntities(generateParameters<1>(getRenderTarget()));
-                break;
-            case 2:
-                generateTilesAndEntities(generateParameters<2>(getRenderTarget()));
-                break;
-            case 3:
-                generateTilesAndEntities(generateParameters<3>(getRenderTarget()));
-                break;
+            currentRotation = Ui::WindowManager::getCurrentRotation();
+            switch (currentRotation)
+            {
+                case 0:
+                    generateTilesAndEntities(generateParameters<0>(getRenderTarget()));
+                    break;
+                case 1:
+                    generateTilesAndEntities(generateParameters<1>(getRenderTarget()));
+                    break;
+                case 2:
+                    generateTilesAndEntities(generateParameters<2>(getRenderTarget()));
+                    break;
+                case 3:
+                    generateTilesAndEntities(generateParameters<3>(getRenderTarget()));
+                    break;
+            }
+
+            if (!usesArena)
+            {
+                return;
+            }
+
+            // Paint structs differ in size so this is measured in PaintEntry sized units
+            const auto usedBytes = reinterpret_cast<uintptr_t>(*_nextFreePaintStruct) - reinterpret_cast<uintptr_t>(getPaintArenaBegin());
+            const auto usedEntries = static_cast<uint32_t>((usedBytes + sizeof(PaintEntry) - 1) / sizeof(PaintEntry));
+            _paintArenaStats.peakEntries = std::max(_paintArenaStats.peakEntries, usedEntries);
+
+            if (*_nextFreePaintStruct < *_endOfPaintStructArray)
+            {
+                return;
+            }
+
+            // The arena is full so structs may have been dropped (most of the allocations are done by the
+            // original game which does not report failures). Grow the arena and generate the column again.
+            _paintArenaStats.overflows++;
+            growPaintArena();
+            init(**_renderTarget, SessionOptions{ currentRotation, _foregroundCullingHeight, _viewFlags });
         }
     }
 
@@ -719,16 +781,13 @@ namespace OpenLoco::Paint
         return nullptr;
     }
 
-    // 0x0045E7B5
-    void PaintSession::arrangeStructs()
+    // Links all quadrants into one list starting at head and sorts it into drawing order
+    static void arrangeQuadrants(PaintStruct& head, PaintStruct* const* quadrants, const uint32_t quadrantBackIndex, const uint32_t quadrantFrontIndex, const uint8_t rotation)
     {
-        _paintHead = _nextFreePaintStruct;
-        _nextFreePaintStruct++;
-
-        PaintStruct* ps = &(*_paintHead)->basic;
+        PaintStruct* ps = &head;
         ps->nextQuadrantPS = nullptr;
 
-        uint32_t quadrantIndex = _quadrantBackIndex;
+        uint32_t quadrantIndex = quadrantBackIndex;
         if (quadrantIndex == std::numeric_limits<uint32_t>::max())
         {
             return;
@@ -736,7 +795,7 @@ namespace OpenLoco::Paint
 
         do
         {
-            PaintStruct* psNext = _quadrants[quadrantIndex];
+            PaintStruct* psNext = quadrants[quadrantIndex];
             if (psNext != nullptr)
             {
                 ps->nextQuadrantPS = psNext;
@@ -747,18 +806,27 @@ namespace OpenLoco::Paint
 
                 } while (psNext != nullptr);
             }
-        } while (++quadrantIndex <= _quadrantFrontIndex);
+        } while (++quadrantIndex <= quadrantFrontIndex);
 
         PaintStruct* psCache = arrangeStructsHelper(
-            &(*_paintHead)->basic, _quadrantBackIndex & 0xFFFF, QuadrantFlags::neighbour, currentRotation);
+            &head, quadrantBackIndex & 0xFFFF, QuadrantFlags::neighbour, rotation);
 
-        quadrantIndex = _quadrantBackIndex;
-        while (++quadrantIndex < _quadrantFrontIndex)
+        quadrantIndex = quadrantBackIndex;
+        while (++quadrantIndex < quadrantFrontIndex)
         {
-            psCache = arrangeStructsHelper(psCache, quadrantIndex & 0xFFFF, QuadrantFlags::none, currentRotation);
+            psCache = arrangeStructsHelper(psCache, quadrantIndex & 0xFFFF, QuadrantFlags::none, rotation);
         }
     }
 
+    // 0x0045E7B5
+    void PaintSession::arrangeStructs()
+    {
+        _paintHead = _nextFreePaintStruct;
+        _nextFreePaintStruct++;
+
+        arrangeQuadrants((*_paintHead)->basic, _quadrants.get(), _quadrantBackIndex, _quadrantFrontIndex, currentRotation);
+    }
+
     static bool isTypeForegroundCullableScenery(const Ui::ViewportInteraction::InteractionItem type)
     {
         switch (type)
@@ -903,19 +971,17 @@ namespace OpenLoco::Paint
         }
     }
 
-    // 0x0045EA23
-    void PaintSession::drawStructs()
+    static void drawPaintStructs(Gfx::RenderTarget& rt, const PaintStruct& head, const Ui::ViewportFlags viewFlags, const uint8_t rotation, const int16_t foregroundCullingHeight)
     {
-        Gfx::RenderTarget& rt = **_renderTarget;
         auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
 
-        for (const auto* ps = (*_paintHead)->basic.nextQuadrantPS; ps != nullptr; ps = ps->nextQuadrantPS)
+        for (const auto* ps = head.nextQuadrantPS; ps != nullptr; ps = ps->nextQuadrantPS)
         {
-            const bool shouldCull = shouldTryCullPaintStruct(*ps, _viewFlags, getRotation(), _foregroundCullingHeight);
+            const bool shouldCull = shouldTryCullPaintStruct(*ps, viewFlags, rotation, foregroundCullingHeight);
 
             if (shouldCull)
             {
-                if (cullPaintStructImage(ps->imageId, _viewFlags))
+                if (cullPaintStructImage(ps->imageId, viewFlags))
                 {
                     continue;
                 }
@@ -927,11 +993,11 @@ namespace OpenLoco::Paint
             for (const auto* childPs = ps->children; childPs != nullptr; childPs = childPs->children)
             {
                 // assert(childPs->attachedPS == nullptr); Children can have attachments but we are skipping them to be investigated!
-                const bool shouldCullChild = shouldTryCullPaintStruct(*childPs, _viewFlags, getRotation(), _foregroundCullingHeight);
+                const bool shouldCullChild = shouldTryCullPaintStruct(*childPs, viewFlags, rotation, foregroundCullingHeight);
 
                 if (shouldCullChild)
                 {
-                    if (cullPaintStructImage(childPs->imageId, _viewFlags))
+                    if (cullPaintStructImage(childPs->imageId, viewFlags))
                     {
                         continue;
                     }
@@ -943,10 +1009,10 @@ namespace OpenLoco::Paint
             // Draw any attachments to the struct
             for (const auto* attachPs = ps->attachedPS; attachPs != nullptr; attachPs = attachPs->next)
             {
-                const bool shouldCullAttach = shouldTryCullPaintStruct(*ps, _viewFlags, getRotation(), _foregroundCullingHeight);
+                const bool shouldCullAttach = shouldTryCullPaintStruct(*ps, viewFlags, rotation, foregroundCullingHeight);
                 if (shouldCullAttach)
                 {
-                    if (cullPaintStructImage(attachPs->imageId, _viewFlags))
+                    if (cullPaintStructImage(attachPs->imageId, viewFlags))
                     {
                         continue;
                     }
@@ -956,17 +1022,21 @@ namespace OpenLoco::Paint
         }
     }
 
-    // 0x0045A60E
-    void PaintSession::drawStringStructs()
+    // 0x0045EA23
+    void PaintSession::drawStructs()
+    {
+        drawPaintStructs(**_renderTarget, (*_paintHead)->basic, _viewFlags, getRotation(), _foregroundCullingHeight);
+    }
+
+    static void drawPaintStringStructs(const Gfx::RenderTarget& rt, PaintStringStruct* psString)
     {
-        PaintStringStruct* psString = _paintStringHead;
         if (psString == nullptr)
         {
             return;
         }
 
-        Gfx::RenderTarget unZoomedRt = **(_renderTarget);
-        const auto zoom = (*_renderTarget)->zoomLevel;
+        Gfx::RenderTarget unZoomedRt = rt;
+        const auto zoom = rt.zoomLevel;
 
         unZoomedRt.zoomLevel = 0;
         unZoomedRt.x >>= zoom;
@@ -991,6 +1061,98 @@ namespace OpenLoco::Paint
         }
     }
 
+    // 0x0045A60E
+    void PaintSession::drawStringStructs()
+    {
+        drawPaintStringStructs(**_renderTarget, _paintStringHead);
+    }
+
+    void DetachedPaintSession::detach(const PaintSession& session)
+    {
+        const auto* srcBegin = reinterpret_cast<const uint8_t*>(_paintArena.data());
+        const auto* srcEnd = reinterpret_cast<const uint8_t*>(*session._nextFreePaintStruct);
+        const auto srcSize = static_cast<size_t>(srcEnd - srcBegin);
+
+        // Leave room for the head struct allocated by arrangeStructs
+        _entries.resize(srcSize + sizeof(PaintEntry));
+        std::memcpy(_entries.data(), srcBegin, srcSize);
+
+        // All links between paint structs point into the pool so they must be moved to the copy
+        auto* dstBegin = _entries.data();
+        auto relocate = [srcBegin, srcEnd, dstBegin](auto* ptr) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(ptr);
+            if (bytes < srcBegin || bytes >= srcEnd)
+            {
+                return ptr;
+            }
+            return reinterpret_cast<decltype(ptr)>(dstBegin + (bytes - srcBegin));
+        };
+
+        _hasMaskedImages = false;
+        auto relocateAttached = [&](PaintStruct& ps) {
+            ps.attachedPS = relocate(ps.attachedPS);
+            for (auto* attached = ps.attachedPS; attached != nullptr; attached = attached->next)
+            {
+                attached->next = relocate(attached->next);
+                _hasMaskedImages |= (attached->flags & PaintStructFlags::hasMaskedImage) != PaintStructFlags::none;
+            }
+        };
+
+        _quadrants.fill(nullptr);
+        _quadrantBackIndex = session._quadrantBackIndex;
+        _quadrantFrontIndex = session._quadrantFrontIndex;
+        if (_quadrantBackIndex != std::numeric_limits<uint32_t>::max())
+        {
+            for (auto i = _quadrantBackIndex; i <= _quadrantFrontIndex; i++)
+            {
+                _quadrants[i] = relocate(session._quadrants[i]);
+                for (auto* ps = _quadrants[i]; ps != nullptr; ps = ps->nextQuadrantPS)
+                {
+                    ps->nextQuadrantPS = relocate(ps->nextQuadrantPS);
+                    _hasMaskedImages |= (ps->flags & PaintStructFlags::hasMaskedImage) != PaintStructFlags::none;
+                    relocateAttached(*ps);
+
+                    ps->children = relocate(ps->children);
+                    for (auto* child = ps->children; child != nullptr; child = child->children)
+                    {
+                        child->children = relocate(child->children);
+                        _hasMaskedImages |= (child->flags & PaintStructFlags::hasMaskedImage) != PaintStructFlags::none;
+                        relocateAttached(*child);
+                    }
+                }
+            }
+        }
+
+        _paintStringHead = relocate(*session._paintStringHead);
+        for (auto* psString = _paintStringHead; psString != nullptr; psString = psString->next)
+        {
+            psString->next = relocate(psString->next);
+        }
+
+        _paintHead = nullptr;
+        _renderTarget = *session._renderTarget;
+        _viewFlags = *session._viewFlags;
+        _foregroundCullingHeight = *session._foregroundCullingHeight;
+        _rotation = session.currentRotation;
+    }
+
+    void DetachedPaintSession::arrangeStructs()
+    {
+        _paintHead = reinterpret_cast<PaintStruct*>(_entries.data() + _entries.size() - sizeof(PaintEntry));
+        *_paintHead = {};
+        arrangeQuadrants(*_paintHead, _quadrants.data(), _quadrantBackIndex, _quadrantFrontIndex, _rotation);
+    }
+
+    void DetachedPaintSession::drawStructs()
+    {
+        drawPaintStructs(*_renderTarget, *_paintHead, _viewFlags, _rotation, _foregroundCullingHeight);
+    }
+
+    void DetachedPaintSession::drawStringStructs()
+    {
+        drawPaintStringStructs(*_renderTarget, _paintStringHead);
+    }
+
     // 0x00447A5F
     static bool isSpriteInteractedWithPaletteSet(Gfx::RenderTarget* rt, uint32_t imageId, const Ui::Point& coords, const Gfx::PaletteMap::View paletteMap)
     {
@@ -6,6 +6,8 @@
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <array>
+#include <vector>
 
 namespace OpenLoco::World
 {
@@ -164,8 +166,12 @@ namespace OpenLoco::Paint
 
     static constexpr auto kMaxPaintQuadrants = 1024;
 
+    struct DetachedPaintSession;
+
     struct PaintSession
     {
+        friend DetachedPaintSession;
+
     public:
         void generate();
         void arrangeStructs();
@@ -328,7 +334,6 @@ namespace OpenLoco::Paint
         inline static Interop::loco_global<PaintEntry*, 0x00E0C404> _endOfPaintStructArray;
         inline static Interop::loco_global<PaintEntry*, 0x00E0C408> _paintHead;
         inline static Interop::loco_global<PaintEntry*, 0x00E0C40C> _nextFreePaintStruct;
-        inline static Interop::loco_global<PaintEntry[4000], 0x00E0C410> _paintEntries;
         inline static Interop::loco_global<coord_t, 0x00E3F090> _spritePositionX;
         inline static Interop::loco_global<coord_t, 0x00E3F092> _unkPositionX;
         inline static Interop::loco_global<int16_t, 0x00E3F094> _vpPositionX;
@@ -390,7 +395,48 @@ namespace OpenLoco::Paint
         PaintStruct* createNormalPaintStruct(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
     };
 
+    /**
+     * Owns a copy of the paint structs of a generated PaintSession along with its own quadrant
+     * table. Generation has to use the single global session as most paint functions are still
+     * implemented by the original game, but arranging and drawing a detached session does not
+     * touch any global state. This allows several columns of a viewport to be drawn in parallel.
+     */
+    struct DetachedPaintSession
+    {
+    public:
+        // Copies the paint structs out of the session, the render target must outlive this
+        void detach(const PaintSession& session);
+        void arrangeStructs();
+        // Must be called on the main thread if hasMaskedImages is true
+        void drawStructs();
+        // Must be called on the main thread
+        void drawStringStructs();
+        // Masked images are still drawn by the original game
+        bool hasMaskedImages() const { return _hasMaskedImages; }
+
+    private:
+        std::vector<uint8_t> _entries; // Paint structs are not all the same size so this is a byte arena
+        std::array<PaintStruct*, kMaxPaintQuadrants> _quadrants{};
+        uint32_t _quadrantBackIndex{};
+        uint32_t _quadrantFrontIndex{};
+        PaintStruct* _paintHead{};
+        PaintStringStruct* _paintStringHead{};
+        Gfx::RenderTarget* _renderTarget{};
+        Ui::ViewportFlags _viewFlags{};
+        int16_t _foregroundCullingHeight{};
+        uint8_t _rotation{};
+        bool _hasMaskedImages{};
+    };
+
     PaintSession* allocateSession(Gfx::RenderTarget& rt, const SessionOptions& options);
 
+    struct PaintArenaStats
+    {
+        uint32_t capacity;    // Size of the paint struct arena in PaintEntry units
+        uint32_t peakEntries; // Most entries used by a single column
+        uint32_t overflows;   // Number of times a column did not fit and the arena was grown
+    };
+    const PaintArenaStats& getPaintArenaStats();
+
     void registerHooks();
 }
@@ -177,36 +177,59 @@ namespace OpenLoco::S5
         return saveDetails;
     }
 
-    /**
-     * Removes all tile elements that have the ghost flag set.
-     * Assumes all elements are organised in tile order.
-     */
-    static void removeGhostElements(std::vector<TileElement>& elements)
+    // Leaves out ghosts, a tile consisting only of ghosts keeps its last element as a tile can not be empty
+    static void appendTileElements(std::vector<TileElement>& batch, stdx::span<const TileElement> tileElements)
     {
-        for (size_t i = 0; i < elements.size(); i++)
+        bool tileHasElements = false;
+        for (const auto& element : tileElements)
         {
-            if (elements[i].isGhost())
+            if (!element.isGhost())
+            {
+                batch.push_back(element);
+                tileHasElements = true;
+            }
+            else if (element.isLast())
             {
-                if (elements[i].isLast())
+                if (tileHasElements)
                 {
-                    if (i == 0 || elements[i - 1].isLast())
-                    {
-                        // First element of tile, can not remove...
-                    }
-                    else
-                    {
-                        elements[i - 1].setLast(true);
-                        elements.erase(elements.begin() + i);
-                        i--;
-                    }
+                    batch.back().setLast(true);
                 }
                 else
                 {
-                    elements.erase(elements.begin() + i);
-                    i--;
+                    batch.push_back(element);
+                }
+            }
+        }
+    }
+
+    /**
+     * Writes the tile elements chunk straight from the tile manager, leaving out elements that
+     * have the ghost flag set. The tiles are walked in order so the elements are written packed
+     * wherever they are in the element pool.
+     */
+    static void writeTileElements(SawyerStreamWriter& fs)
+    {
+        constexpr size_t kBatchSize = 4096;
+        std::vector<TileElement> batch;
+        batch.reserve(kBatchSize);
+
+        for (tile_coord_t y = 0; y < World::kMapRows; y++)
+        {
+            for (tile_coord_t x = 0; x < World::kMapColumns; x++)
+            {
+                // Same layout as World::TileElement
+                const auto tile = TileManager::get(World::TilePos2(x, y));
+                const auto* first = reinterpret_cast<const TileElement*>(tile.begin());
+                appendTileElements(batch, stdx::span<const TileElement>(first, tile.end() - tile.begin()));
+
+                if (batch.size() >= kBatchSize)
+                {
+                    fs.writeChunkData(batch.data(), batch.size() * sizeof(TileElement));
+                    batch.clear();
                 }
             }
         }
+        fs.writeChunkData(batch.data(), batch.size() * sizeof(TileElement));
     }
 
     static std::unique_ptr<S5File> prepareGameState(SaveFlags flags, const std::vector<ObjectHeader>& requiredObjects, const std::vector<ObjectHeader>& packedObjects)
@@ -232,10 +255,7 @@ namespace OpenLoco::S5
         file->gameState.savedViewRotation = savedView.rotation;
         file->gameState.magicNumber = kMagicNumber; // Match implementation at 0x004437FC
 
-        auto tileElements = TileManager::getElements();
-        file->tileElements.resize(tileElements.size());
-        std::memcpy(file->tileElements.data(), tileElements.data(), tileElements.size_bytes());
-        removeGhostElements(file->tileElements);
+        // Tile elements are written straight from the tile manager by exportGameState
         return file;
     }
 
@@ -265,7 +285,6 @@ namespace OpenLoco::S5
 
         if ((flags & SaveFlags::raw) == SaveFlags::none)
         {
-            TileManager::reorganise();
             EntityManager::resetSpatialIndex();
             EntityManager::zeroUnused();
             StationManager::zeroUnused();
@@ -344,7 +363,9 @@ namespace OpenLoco::S5
             }
             else
             {
-                fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+                fs.beginChunk(SawyerEncoding::runLengthMulti);
+                writeTileElements(fs);
+                fs.endChunk();
             }
 
             fs.writeChecksum();
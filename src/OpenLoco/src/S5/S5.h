@@ -119,8 +119,9 @@ namespace OpenLoco::S5
 
         // new fields:
         LandGeneratorType generator;
+        uint32_t seed; // Seed for the modern generator, 0 picks a random one
 
-        std::byte pad_41BD[348];
+        std::byte pad_41C1[344];
     };
 #pragma pack(pop)
 
@@ -0,0 +1,492 @@
+#include "SawyerCodec.h"
+#include <OpenLoco/Utility/Numeric.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#define OPENLOCO_SAWYER_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+// Allows the intrinsics to be used without enabling them for the whole build
+#define OPENLOCO_TARGET_SSE2 __attribute__((target("sse2")))
+#define OPENLOCO_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define OPENLOCO_TARGET_SSE2
+#define OPENLOCO_TARGET_AVX2
+#endif
+
+namespace OpenLoco::SawyerCodec
+{
+    // Rotation amount repeats every 4 bytes
+    static constexpr uint8_t kRotation[] = { 1, 3, 5, 7 };
+    static constexpr uint8_t kInverseRotation[] = { 7, 5, 3, 1 };
+
+    static constexpr size_t kMatchWindow = 32;
+    static constexpr size_t kMaxMatchLength = 8;
+
+    namespace Scalar
+    {
+        static uint32_t sumBytes(const uint8_t* src, size_t len)
+        {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < len; i++)
+            {
+                sum += src[i];
+            }
+            return sum;
+        }
+
+        // start is the position of src within the whole chunk
+        static void rotateLeft(uint8_t* dst, const uint8_t* src, size_t len, size_t start, const uint8_t (&shifts)[4])
+        {
+            for (size_t i = 0; i < len; i++)
+            {
+                dst[i] = Utility::rol(src[i], shifts[(start + i) & 3]);
+            }
+        }
+
+        static const uint8_t* findRepeat(const uint8_t* src, const uint8_t* end)
+        {
+            for (; src < end - 1; src++)
+            {
+                if (src[0] == src[1])
+                {
+                    return src;
+                }
+            }
+            return end - 1;
+        }
+
+        static size_t countRepeat(const uint8_t* src, size_t start, size_t maxLen)
+        {
+            size_t count = start;
+            while (count < maxLen && src[count] == src[0])
+            {
+                count++;
+            }
+            return count;
+        }
+
+        static size_t matchLength(const uint8_t* a, const uint8_t* b, size_t maxLen)
+        {
+            size_t count = 0;
+            while (count < maxLen && a[count] == b[count])
+            {
+                count++;
+            }
+            return count;
+        }
+
+        static Match findMatch(const uint8_t* src, size_t pos, size_t len)
+        {
+            Match best{};
+            const auto searchStart = pos < kMatchWindow ? 0 : pos - kMatchWindow;
+            for (size_t index = searchStart; index < pos; index++)
+            {
+                const auto maxLen = std::min({ kMaxMatchLength, pos - index, len - pos });
+                const auto length = matchLength(src + index, src + pos, maxLen);
+                if (length > best.length)
+                {
+                    best = { index, length };
+                    if (length == kMaxMatchLength)
+                    {
+                        break;
+                    }
+                }
+            }
+            return best;
+        }
+    }
+
+#ifdef OPENLOCO_SAWYER_X86
+    namespace Sse2
+    {
+        OPENLOCO_TARGET_SSE2 static uint32_t sumBytes(const uint8_t* src, size_t len)
+        {
+            const auto zero = _mm_setzero_si128();
+            auto sum = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16)
+            {
+                const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                sum = _mm_add_epi64(sum, _mm_sad_epu8(v, zero));
+            }
+            const auto total = static_cast<uint32_t>(_mm_cvtsi128_si32(sum)) + static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(sum, 8)));
+            return total + Scalar::sumBytes(src + i, len - i);
+        }
+
+        // Rotates every byte left by TShift
+        template<int TShift>
+        OPENLOCO_TARGET_SSE2 static __m128i rotateBytes(__m128i v)
+        {
+            const auto hi = _mm_and_si128(_mm_slli_epi16(v, TShift), _mm_set1_epi8(static_cast<char>(0xFF << TShift)));
+            const auto lo = _mm_and_si128(_mm_srli_epi16(v, 8 - TShift), _mm_set1_epi8(static_cast<char>(0xFF >> (8 - TShift))));
+            return _mm_or_si128(hi, lo);
+        }
+
+        // Rotates the bytes at positions 4n, 4n + 1, 4n + 2, 4n + 3 left by TShift0, TShift1, TShift2, TShift3
+        template<int TShift0, int TShift1, int TShift2, int TShift3>
+        OPENLOCO_TARGET_SSE2 static __m128i rotatePattern(__m128i v)
+        {
+            const auto lane0 = _mm_set1_epi32(0x000000FF);
+            const auto lane1 = _mm_set1_epi32(0x0000FF00);
+            const auto lane2 = _mm_set1_epi32(0x00FF0000);
+            const auto lane3 = _mm_set1_epi32(static_cast<int>(0xFF000000));
+            auto result = _mm_and_si128(rotateBytes<TShift0>(v), lane0);
+            result = _mm_or_si128(result, _mm_and_si128(rotateBytes<TShift1>(v), lane1));
+            result = _mm_or_si128(result, _mm_and_si128(rotateBytes<TShift2>(v), lane2));
+            result = _mm_or_si128(result, _mm_and_si128(rotateBytes<TShift3>(v), lane3));
+            return result;
+        }
+
+        OPENLOCO_TARGET_SSE2 static void rotateLeft(uint8_t* dst, const uint8_t* src, size_t len)
+        {
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16)
+            {
+                const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), rotatePattern<1, 3, 5, 7>(v));
+            }
+            Scalar::rotateLeft(dst + i, src + i, len - i, i, kRotation);
+        }
+
+        OPENLOCO_TARGET_SSE2 static void rotateRight(uint8_t* dst, const uint8_t* src, size_t len)
+        {
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16)
+            {
+                const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), rotatePattern<7, 5, 3, 1>(v));
+            }
+            Scalar::rotateLeft(dst + i, src + i, len - i, i, kInverseRotation);
+        }
+
+        OPENLOCO_TARGET_SSE2 static const uint8_t* findRepeat(const uint8_t* src, const uint8_t* end)
+        {
+            // Both loads must stay within [src, end)
+            for (; end - src >= 17; src += 16)
+            {
+                const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+                const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 1));
+                const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v0, v1)));
+                if (mask != 0)
+                {
+                    return src + Utility::bitScanForward(mask);
+                }
+            }
+            return Scalar::findRepeat(src, end);
+        }
+
+        OPENLOCO_TARGET_SSE2 static size_t countRepeat(const uint8_t* src, size_t maxLen)
+        {
+            const auto value = _mm_set1_epi8(static_cast<char>(src[0]));
+            size_t count = 0;
+            for (; count + 16 <= maxLen; count += 16)
+            {
+                const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count));
+                const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, value)));
+                if (mask != 0xFFFF)
+                {
+                    return count + Utility::bitScanForward(~mask);
+                }
+            }
+            return Scalar::countRepeat(src, count, maxLen);
+        }
+
+        OPENLOCO_TARGET_SSE2 static Match findMatch(const uint8_t* src, size_t pos, size_t len)
+        {
+            if (len - pos < kMaxMatchLength)
+            {
+                return Scalar::findMatch(src, pos, len);
+            }
+
+            Match best{};
+            const auto needle = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + pos));
+            const auto searchStart = pos < kMatchWindow ? 0 : pos - kMatchWindow;
+            for (size_t index = searchStart; index < pos; index++)
+            {
+                const auto candidate = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + index));
+                // Set a bit past the last byte so that a full match scans to kMaxMatchLength
+                const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(candidate, needle))) & 0xFF;
+                const auto length = std::min<size_t>(Utility::bitScanForward(~mask | 0x100), pos - index);
+                if (length > best.length)
+                {
+                    best = { index, length };
+                    if (length == kMaxMatchLength)
+                    {
+                        break;
+                    }
+                }
+            }
+            return best;
+        }
+    }
+
+    namespace Avx2
+    {
+        OPENLOCO_TARGET_AVX2 static uint32_t sumBytes(const uint8_t* src, size_t len)
+        {
+            const auto zero = _mm256_setzero_si256();
+            auto sum = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 32 <= len; i += 32)
+            {
+                const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                sum = _mm256_add_epi64(sum, _mm256_sad_epu8(v, zero));
+            }
+            const auto sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            const auto total = static_cast<uint32_t>(_mm_cvtsi128_si32(sum128)) + static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(sum128, 8)));
+            return total + Scalar::sumBytes(src + i, len - i);
+        }
+
+        // Rotates the bytes at positions 4n, 4n + 1, 4n + 2, 4n + 3 left by shifts[0], shifts[1], shifts[2], shifts[3].
+        // Each byte position is isolated within the 32 bit lanes so the bits shifted out of it can be masked away.
+        OPENLOCO_TARGET_AVX2 static void rotate(uint8_t* dst, const uint8_t* src, size_t len, const uint8_t (&shifts)[4])
+        {
+            __m256i byteMasks[4];
+            __m128i leftShifts[4];
+            __m128i rightShifts[4];
+            for (int k = 0; k < 4; k++)
+            {
+                byteMasks[k] = _mm256_set1_epi32(static_cast<int>(0xFFU << (k * 8)));
+                leftShifts[k] = _mm_cvtsi32_si128(shifts[k]);
+                rightShifts[k] = _mm_cvtsi32_si128(8 - shifts[k]);
+            }
+
+            size_t i = 0;
+            for (; i + 32 <= len; i += 32)
+            {
+                const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                auto result = _mm256_setzero_si256();
+                for (int k = 0; k < 4; k++)
+                {
+                    const auto x = _mm256_and_si256(v, byteMasks[k]);
+                    const auto rotated = _mm256_or_si256(_mm256_sll_epi32(x, leftShifts[k]), _mm256_srl_epi32(x, rightShifts[k]));
+                    result = _mm256_or_si256(result, _mm256_and_si256(rotated, byteMasks[k]));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+            }
+            Scalar::rotateLeft(dst + i, src + i, len - i, i, shifts);
+        }
+
+        OPENLOCO_TARGET_AVX2 static void rotateLeft(uint8_t* dst, const uint8_t* src, size_t len)
+        {
+            rotate(dst, src, len, kRotation);
+        }
+
+        OPENLOCO_TARGET_AVX2 static void rotateRight(uint8_t* dst, const uint8_t* src, size_t len)
+        {
+            // Rotating right by n is rotating left by 8 - n
+            rotate(dst, src, len, kInverseRotation);
+        }
+        OPENLOCO_TARGET_AVX2 static const uint8_t* findRepeat(const uint8_t* src, const uint8_t* end)
+        {
+            // Both loads must stay within [src, end)
+            for (; end - src >= 33; src += 32)
+            {
+                const auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+                const auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 1));
+                const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v0, v1)));
+                if (mask != 0)
+                {
+                    return src + Utility::bitScanForward(mask);
+                }
+            }
+            return Sse2::findRepeat(src, end);
+        }
+
+        OPENLOCO_TARGET_AVX2 static size_t countRepeat(const uint8_t* src, size_t maxLen)
+        {
+            const auto value = _mm256_set1_epi8(static_cast<char>(src[0]));
+            size_t count = 0;
+            for (; count + 32 <= maxLen; count += 32)
+            {
+                const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + count));
+                const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, value)));
+                if (mask != 0xFFFFFFFF)
+                {
+                    return count + Utility::bitScanForward(~mask);
+                }
+            }
+            return Scalar::countRepeat(src, count, maxLen);
+        }
+    }
+#endif
+
+    struct Kernels
+    {
+        uint32_t (*sumBytes)(const uint8_t*, size_t);
+        void (*rotateLeft)(uint8_t*, const uint8_t*, size_t);
+        void (*rotateRight)(uint8_t*, const uint8_t*, size_t);
+        const uint8_t* (*findRepeat)(const uint8_t*, const uint8_t*);
+        size_t (*countRepeat)(const uint8_t*, size_t);
+        Match (*findMatch)(const uint8_t*, size_t, size_t);
+    };
+
+    static constexpr Kernels kScalarKernels = {
+        Scalar::sumBytes,
+        [](uint8_t* dst, const uint8_t* src, size_t len) { Scalar::rotateLeft(dst, src, len, 0, kRotation); },
+        [](uint8_t* dst, const uint8_t* src, size_t len) { Scalar::rotateLeft(dst, src, len, 0, kInverseRotation); },
+        Scalar::findRepeat,
+        [](const uint8_t* src, size_t maxLen) { return Scalar::countRepeat(src, 0, maxLen); },
+        Scalar::findMatch,
+    };
+
+#ifdef OPENLOCO_SAWYER_X86
+    static constexpr Kernels kSse2Kernels = {
+        Sse2::sumBytes,
+        Sse2::rotateLeft,
+        Sse2::rotateRight,
+        Sse2::findRepeat,
+        Sse2::countRepeat,
+        Sse2::findMatch,
+    };
+
+    static constexpr Kernels kAvx2Kernels = {
+        Avx2::sumBytes,
+        Avx2::rotateLeft,
+        Avx2::rotateRight,
+        Avx2::findRepeat,
+        Avx2::countRepeat,
+        // Matches are at most 8 bytes, wider vectors do not help
+        Sse2::findMatch,
+    };
+#endif
+
+    static SimdLevel detectSimdLevel()
+    {
+#if defined(OPENLOCO_SAWYER_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        const auto maxLeaf = info[0];
+        __cpuid(info, 1);
+        const bool hasSse2 = (info[3] & (1 << 26)) != 0;
+        const bool hasOsXSave = (info[2] & (1 << 27)) != 0;
+        const bool hasAvx = (info[2] & (1 << 28)) != 0;
+        bool hasAvx2 = false;
+        // The OS must also save the upper halves of the vector registers
+        if (maxLeaf >= 7 && hasOsXSave && hasAvx && (_xgetbv(0) & 0x6) == 0x6)
+        {
+            __cpuidex(info, 7, 0);
+            hasAvx2 = (info[1] & (1 << 5)) != 0;
+        }
+#elif defined(OPENLOCO_SAWYER_X86)
+        __builtin_cpu_init();
+        const bool hasSse2 = __builtin_cpu_supports("sse2");
+        const bool hasAvx2 = __builtin_cpu_supports("avx2");
+#else
+        const bool hasSse2 = false;
+        const bool hasAvx2 = false;
+#endif
+        if (hasAvx2)
+        {
+            return SimdLevel::avx2;
+        }
+        if (hasSse2)
+        {
+            return SimdLevel::sse2;
+        }
+        return SimdLevel::scalar;
+    }
+
+    static const Kernels& getKernelsForLevel(SimdLevel level)
+    {
+#ifdef OPENLOCO_SAWYER_X86
+        switch (level)
+        {
+            case SimdLevel::avx2:
+                return kAvx2Kernels;
+            case SimdLevel::sse2:
+                return kSse2Kernels;
+            case SimdLevel::scalar:
+                break;
+        }
+#else
+        static_cast<void>(level);
+#endif
+        return kScalarKernels;
+    }
+
+    // Null until first use so that the kernels can be used during static initialisation
+    static std::atomic<SimdLevel> _simdLevel{ SimdLevel::scalar };
+    static std::atomic<const Kernels*> _kernels{ nullptr };
+
+    static const Kernels& getKernels()
+    {
+        const auto* kernels = _kernels.load(std::memory_order_relaxed);
+        if (kernels == nullptr)
+        {
+            setSimdLevel(getSupportedSimdLevel());
+            kernels = _kernels.load(std::memory_order_relaxed);
+        }
+        return *kernels;
+    }
+
+    SimdLevel getSupportedSimdLevel()
+    {
+        static const SimdLevel supportedLevel = detectSimdLevel();
+        return supportedLevel;
+    }
+
+    SimdLevel getSimdLevel()
+    {
+        getKernels();
+        return _simdLevel;
+    }
+
+    void setSimdLevel(SimdLevel level)
+    {
+        _simdLevel = std::min(level, getSupportedSimdLevel());
+        _kernels = &getKernelsForLevel(_simdLevel);
+    }
+
+    const char* getSimdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+            case SimdLevel::avx2:
+                return "avx2";
+            case SimdLevel::sse2:
+                return "sse2";
+            case SimdLevel::scalar:
+                break;
+        }
+        return "scalar";
+    }
+
+    uint32_t sumBytes(const uint8_t* src, size_t len)
+    {
+        return getKernels().sumBytes(src, len);
+    }
+
+    void rotateLeft(uint8_t* dst, const uint8_t* src, size_t len)
+    {
+        getKernels().rotateLeft(dst, src, len);
+    }
+
+    void rotateRight(uint8_t* dst, const uint8_t* src, size_t len)
+    {
+        getKernels().rotateRight(dst, src, len);
+    }
+
+    const uint8_t* findRepeat(const uint8_t* src, const uint8_t* end)
+    {
+        return getKernels().findRepeat(src, end);
+    }
+
+    size_t countRepeat(const uint8_t* src, size_t maxLen)
+    {
+        return getKernels().countRepeat(src, maxLen);
+    }
+
+    Match findMatch(const uint8_t* src, size_t pos, size_t len)
+    {
+        return getKernels().findMatch(src, pos, len);
+    }
+}
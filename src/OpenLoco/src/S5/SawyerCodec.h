@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Byte kernels used by the sawyer encodings. Each kernel has a scalar, SSE2 and AVX2
+// implementation, the best one supported by the CPU is selected on first use.
+namespace OpenLoco::SawyerCodec
+{
+    enum class SimdLevel : uint8_t
+    {
+        scalar,
+        sse2,
+        avx2,
+    };
+
+    // Highest level supported by this build and CPU
+    SimdLevel getSupportedSimdLevel();
+    SimdLevel getSimdLevel();
+    // Clamped to the supported level, used to compare the implementations
+    void setSimdLevel(SimdLevel level);
+    const char* getSimdLevelName(SimdLevel level);
+
+    // Sum of all bytes, wrapping at 32 bits
+    uint32_t sumBytes(const uint8_t* src, size_t len);
+
+    // Rotates each byte left (encode) or right (decode) by 1, 3, 5, 7, 1, 3, ... bits
+    void rotateLeft(uint8_t* dst, const uint8_t* src, size_t len);
+    void rotateRight(uint8_t* dst, const uint8_t* src, size_t len);
+
+    // Returns the first position p in [src, end - 1) where p[0] == p[1], or end - 1 if there is none
+    const uint8_t* findRepeat(const uint8_t* src, const uint8_t* end);
+
+    // Returns how many bytes from the start of src are equal to src[0], at most maxLen
+    size_t countRepeat(const uint8_t* src, size_t maxLen);
+
+    struct Match
+    {
+        size_t index;
+        size_t length;
+    };
+
+    // Finds the longest (up to 8 bytes) earliest copy of the bytes at src[pos] within the
+    // 32 bytes before it, the copy may not overlap pos. Length is 0 if there is none.
+    Match findMatch(const uint8_t* src, size_t pos, size_t len);
+}
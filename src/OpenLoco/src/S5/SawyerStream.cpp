@@ -1,5 +1,5 @@
 #include "SawyerStream.h"
-#include <OpenLoco/Utility/Numeric.hpp>
+#include "SawyerCodec.h"
 #include <algorithm>
 #include <cassert>
 #include <cstring>
@@ -20,6 +20,15 @@ constexpr const char* exceptionReadError = "Failed to read data from stream";
 constexpr const char* exceptionWriteError = "Failed to write data to stream";
 constexpr const char* exceptionInvalidRLE = "Invalid RLE run";
 constexpr const char* exceptionUnknownEncoding = "Unknown encoding";
+constexpr const char* exceptionChunkState = "Invalid chunk state";
+
+// How much data writeChunkData collects before encoding it
+constexpr size_t kChunkDataBlockSize = 64 * 1024;
+// Furthest a run length single decision looks ahead (longest run plus a byte)
+constexpr size_t kRunLengthSingleLookahead = 128;
+// Furthest back and ahead a run length multi repeat can reach
+constexpr size_t kRunLengthMultiHistory = 32;
+constexpr size_t kRunLengthMultiLookahead = 8;
 
 uint8_t* FastBuffer::alloc(size_t len)
 {
@@ -120,6 +129,16 @@ void FastBuffer::push_back(const uint8_t* src, size_t len)
     _len += len;
 }
 
+void FastBuffer::consume(size_t len)
+{
+    assert(len <= _len);
+    if (len != 0)
+    {
+        std::memmove(_data, _data + len, _len - len);
+        _len -= len;
+    }
+}
+
 stdx::span<uint8_t const> FastBuffer::getSpan() const
 {
     return stdx::span<uint8_t const>(_data, _len);
@@ -184,15 +203,14 @@ bool SawyerStreamReader::validateChecksum()
         // Calculate checksum
         uint32_t actualChecksum = 0;
         _stream->setPosition(0);
-        uint8_t buffer[2048];
-        for (uint32_t i = 0; i < fileLength - 4; i += sizeof(buffer))
+        constexpr size_t kBufferSize = 64 * 1024;
+        FastBuffer buffer;
+        buffer.resize(kBufferSize);
+        for (uint32_t i = 0; i < fileLength - 4; i += kBufferSize)
         {
-            auto readLength = std::min<size_t>(sizeof(buffer), fileLength - 4 - i);
-            _stream->read(buffer, readLength);
-            for (size_t j = 0; j < readLength; j++)
-            {
-                actualChecksum += buffer[j];
-            }
+            auto readLength = std::min<size_t>(kBufferSize, fileLength - 4 - i);
+            _stream->read(buffer.data(), readLength);
+            actualChecksum += SawyerCodec::sumBytes(buffer.data(), readLength);
         }
 
         valid = checksum == actualChecksum;
@@ -307,12 +325,9 @@ void SawyerStreamReader::decodeRunLengthMulti(FastBuffer& buffer, stdx::span<uin
 
 void SawyerStreamReader::decodeRotate(FastBuffer& buffer, stdx::span<uint8_t const> data)
 {
-    uint8_t code = 1;
-    for (size_t i = 0; i < data.size(); i++)
-    {
-        buffer.push_back(OpenLoco::Utility::ror(data[i], code));
-        code = (code + 2) & 7;
-    }
+    const auto offset = buffer.size();
+    buffer.resize(offset + data.size());
+    SawyerCodec::rotateRight(buffer.data() + offset, data.data(), data.size());
 }
 
 SawyerStreamWriter::SawyerStreamWriter(Stream& stream)
@@ -334,14 +349,95 @@ void SawyerStreamWriter::writeChunk(SawyerEncoding chunkType, const void* data,
     write(encodedData.data(), encodedData.size());
 }
 
-void SawyerStreamWriter::write(const void* data, size_t dataLen)
+void SawyerStreamWriter::beginChunk(SawyerEncoding chunkType)
+{
+    if (chunkType == SawyerEncoding::rotate)
+    {
+        throw std::runtime_error(exceptionUnknownEncoding);
+    }
+    _chunkEncoding = chunkType;
+    _chunkLength = 0;
+    _chunkMultiPosition = 0;
+    _chunkMultiInput.clear();
+    _chunkSingleInput.clear();
+
+    write(&chunkType, sizeof(chunkType));
+    // Length is not known yet, it is filled in and added to the checksum by endChunk
+    _chunkLengthPosition = _stream->getPosition();
+    const uint32_t placeholderLength = 0;
+    writeStream(&placeholderLength, sizeof(placeholderLength));
+}
+
+void SawyerStreamWriter::writeChunkData(const void* data, size_t dataLen)
 {
-    writeStream(data, dataLen);
     auto data8 = reinterpret_cast<const uint8_t*>(data);
-    for (size_t i = 0; i < dataLen; i++)
+    switch (_chunkEncoding)
+    {
+        case SawyerEncoding::uncompressed:
+            write(data8, dataLen);
+            _chunkLength += static_cast<uint32_t>(dataLen);
+            break;
+        case SawyerEncoding::runLengthSingle:
+            _chunkSingleInput.push_back(data8, dataLen);
+            if (_chunkSingleInput.size() >= kChunkDataBlockSize)
+            {
+                encodeChunkData(false);
+            }
+            break;
+        case SawyerEncoding::runLengthMulti:
+            _chunkMultiInput.push_back(data8, dataLen);
+            if (_chunkMultiInput.size() - _chunkMultiPosition >= kChunkDataBlockSize)
+            {
+                encodeChunkData(false);
+            }
+            break;
+        default:
+            throw std::runtime_error(exceptionChunkState);
+    }
+}
+
+void SawyerStreamWriter::encodeChunkData(bool isFinal)
+{
+    if (_chunkEncoding == SawyerEncoding::runLengthMulti)
+    {
+        _encodeBuffer.clear();
+        auto position = encodeRunLengthMulti(_encodeBuffer, _chunkMultiInput.getSpan(), _chunkMultiPosition, isFinal);
+
+        // Only keep what later repeats can refer back to
+        const auto discard = position > kRunLengthMultiHistory ? position - kRunLengthMultiHistory : 0;
+        _chunkMultiInput.consume(discard);
+        _chunkMultiPosition = position - discard;
+
+        _chunkSingleInput.push_back(_encodeBuffer.data(), _encodeBuffer.size());
+    }
+
+    _encodeBuffer2.clear();
+    auto consumed = encodeRunLengthSingle(_encodeBuffer2, _chunkSingleInput.getSpan(), isFinal);
+    _chunkSingleInput.consume(consumed);
+    write(_encodeBuffer2.data(), _encodeBuffer2.size());
+    _chunkLength += static_cast<uint32_t>(_encodeBuffer2.size());
+}
+
+void SawyerStreamWriter::endChunk()
+{
+    if (_chunkEncoding != SawyerEncoding::uncompressed)
     {
-        _checksum += data8[i];
+        encodeChunkData(true);
     }
+
+    const auto endPosition = _stream->getPosition();
+    _stream->setPosition(_chunkLengthPosition);
+    write(_chunkLength);
+    _stream->setPosition(endPosition);
+
+    _chunkMultiInput.clear();
+    _chunkSingleInput.clear();
+}
+
+void SawyerStreamWriter::write(const void* data, size_t dataLen)
+{
+    writeStream(data, dataLen);
+    _checksum += SawyerCodec::sumBytes(reinterpret_cast<const uint8_t*>(data), dataLen);
 }
 
 void SawyerStreamWriter::writeChecksum()
@@ -397,14 +493,22 @@ stdx::span<uint8_t const> SawyerStreamWriter::encode(SawyerEncoding encoding, st
     }
 }
 
-void SawyerStreamWriter::encodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data)
+size_t SawyerStreamWriter::encodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data, bool isFinal)
 {
+    if (data.empty())
+    {
+        return 0;
+    }
+
     auto src = data.data();
     auto srcEnd = src + data.size();
     auto srcNormStart = src;
     uint8_t count = 0;
 
-    while (src < srcEnd - 1)
+    // Stopping at srcNormStart and continuing from there with more data gives the same result
+    // as long as every decision made could see its whole lookahead
+    auto srcStop = isFinal ? srcEnd - 1 : srcEnd - std::min(data.size(), kRunLengthSingleLookahead);
+    while (src < srcStop)
     {
         if ((count != 0 && src[0] == src[1]) || count > 125)
         {
@@ -415,13 +519,7 @@ void SawyerStreamWriter::encodeRunLengthSingle(FastBuffer& buffer, stdx::span<ui
         }
         if (src[0] == src[1])
         {
-            for (; count < 125 && src + count < srcEnd; count++)
-            {
-                if (src[0] != src[count])
-                {
-                    break;
-                }
-            }
+            count = static_cast<uint8_t>(SawyerCodec::countRepeat(src, std::min<size_t>(125, srcEnd - src)));
             buffer.push_back(257 - count);
             buffer.push_back(src[0]);
             src += count;
@@ -430,10 +528,17 @@ void SawyerStreamWriter::encodeRunLengthSingle(FastBuffer& buffer, stdx::span<ui
         }
         else
         {
-            count++;
-            src++;
+            // Skip to the next repeated byte, but no further than the longest literal run
+            auto next = SawyerCodec::findRepeat(src + 1, srcEnd);
+            auto skip = static_cast<uint8_t>(std::min<size_t>(next - src, 126 - count));
+            count += skip;
+            src += skip;
         }
     }
+    if (!isFinal)
+    {
+        return srcNormStart - data.data();
+    }
     if (src == srcEnd - 1)
     {
         count++;
@@ -443,57 +548,33 @@ void SawyerStreamWriter::encodeRunLengthSingle(FastBuffer& buffer, stdx::span<ui
         buffer.push_back(count - 1);
         buffer.push_back(srcNormStart, count);
     }
+    return data.size();
 }
 
-void SawyerStreamWriter::encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data)
+size_t SawyerStreamWriter::encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data, size_t start, bool isFinal)
 {
     auto src = data.data();
     auto srcLen = data.size();
-    if (srcLen == 0)
-        return;
-
-    // Need to emit at least one byte, otherwise there is nothing to repeat
-    buffer.push_back(255);
-    buffer.push_back(src[0]);
+    if (srcLen == start)
+        return start;
 
-    // Iterate through remainder of the source buffer
-    for (size_t i = 1; i < srcLen;)
+    if (start == 0)
     {
-        size_t searchIndex = (i < 32) ? 0 : (i - 32);
-        size_t searchEnd = i - 1;
-
-        size_t bestRepeatIndex = 0;
-        size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
-        {
-            size_t repeatCount = 0;
-            size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), srcLen - i - 1);
-            // maxRepeatCount should not exceed srcLen
-            assert(repeatIndex + maxRepeatCount < srcLen);
-            assert(i + maxRepeatCount < srcLen);
-            for (size_t j = 0; j <= maxRepeatCount; j++)
-            {
-                if (src[repeatIndex + j] == src[i + j])
-                {
-                    repeatCount++;
-                }
-                else
-                {
-                    break;
-                }
-            }
-            if (repeatCount > bestRepeatCount)
-            {
-                bestRepeatIndex = repeatIndex;
-                bestRepeatCount = repeatCount;
+        // Need to emit at least one byte, otherwise there is nothing to repeat
+        buffer.push_back(255);
+        buffer.push_back(src[0]);
+        start = 1;
+    }
 
-                // Maximum repeat count is 8
-                if (repeatCount == 8)
-                    break;
-            }
-        }
+    // Unless this is the end of the data, repeats must not be cut short by the end of the data
+    const auto srcStop = isFinal ? srcLen : srcLen - std::min(srcLen, kRunLengthMultiLookahead - 1);
 
-        if (bestRepeatCount == 0)
+    // Iterate through remainder of the source buffer
+    size_t i = start;
+    while (i < srcStop)
+    {
+        const auto match = SawyerCodec::findMatch(src, i, srcLen);
+        if (match.length == 0)
         {
             buffer.push_back(255);
             buffer.push_back(src[i]);
@@ -501,18 +582,16 @@ void SawyerStreamWriter::encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uin
         }
         else
         {
-            buffer.push_back(static_cast<uint8_t>((bestRepeatCount - 1) | ((32 - (i - bestRepeatIndex)) << 3)));
-            i += bestRepeatCount;
+            buffer.push_back(static_cast<uint8_t>((match.length - 1) | ((32 - (i - match.index)) << 3)));
+            i += match.length;
         }
     }
+    return i;
 }
 
 void SawyerStreamWriter::encodeRotate(FastBuffer& buffer, stdx::span<uint8_t const> data)
 {
-    uint8_t code = 1;
-    for (size_t i = 0; i < data.size(); i++)
-    {
-        buffer.push_back(Utility::rol(data[i], code));
-        code = (code + 2) & 7;
-    }
+    const auto offset = buffer.size();
+    buffer.resize(offset + data.size());
+    SawyerCodec::rotateLeft(buffer.data() + offset, data.data(), data.size());
 }
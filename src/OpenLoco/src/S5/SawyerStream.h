@@ -46,6 +46,8 @@ namespace OpenLoco
         void push_back(uint8_t value);
         void push_back(uint8_t value, size_t len);
         void push_back(const uint8_t* src, size_t len);
+        // Removes len bytes from the start of the buffer
+        void consume(size_t len);
         stdx::span<uint8_t const> getSpan() const;
     };
 
@@ -82,10 +84,21 @@ namespace OpenLoco
         FastBuffer _encodeBuffer;
         FastBuffer _encodeBuffer2;
 
+        // State of the chunk being written by beginChunk, writeChunkData and endChunk
+        SawyerEncoding _chunkEncoding{};
+        uint64_t _chunkLengthPosition{};
+        uint32_t _chunkLength{};
+        size_t _chunkMultiPosition{};
+        FastBuffer _chunkMultiInput;
+        FastBuffer _chunkSingleInput;
+
         void writeStream(const void* data, size_t dataLen);
+        void encodeChunkData(bool isFinal);
         stdx::span<uint8_t const> encode(SawyerEncoding encoding, stdx::span<uint8_t const> data);
-        static void encodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data);
-        static void encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data);
+        // Unless isFinal, only encodes what does not depend on data still to come and returns how much was consumed
+        static size_t encodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data, bool isFinal = true);
+        // Encodes from data[start], earlier bytes are history for repeats. Returns the position encoding stopped at.
+        static size_t encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data, size_t start = 0, bool isFinal = true);
         static void encodeRotate(FastBuffer& buffer, stdx::span<uint8_t const> data);
 
     public:
@@ -93,6 +106,14 @@ namespace OpenLoco
         SawyerStreamWriter(const fs::path& path);
 
         void writeChunk(SawyerEncoding chunkType, const void* data, size_t dataLen);
+
+        // Writes a chunk whose data is provided in pieces, only a small part of the data is held in memory.
+        // The stream must be seekable as the chunk length is written by endChunk.
+        // Supports all encodings except rotate.
+        void beginChunk(SawyerEncoding chunkType);
+        void writeChunkData(const void* data, size_t dataLen);
+        void endChunk();
+
         void write(const void* data, size_t dataLen);
         void writeChecksum();
         void close();
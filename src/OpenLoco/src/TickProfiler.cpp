@@ -0,0 +1,150 @@
+#include "TickProfiler.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace OpenLoco::TickProfiler
+{
+    static constexpr std::array<const char*, static_cast<size_t>(Stage::count)> kStageNames = {
+        "tick",
+        "gameCommands",
+        "tileReorganise",
+        "dateTick",
+        "tileManager",
+        "waveManager",
+        "townManager",
+        "industryManager",
+        "vehicleManager",
+        "stationManager",
+        "effectsManager",
+        "companyManager",
+        "animationManager",
+        "audio",
+        "title",
+    };
+
+    struct StageSummary
+    {
+        size_t count;
+        double total; // Microseconds
+        double p50;   // Microseconds
+        double p95;   // Microseconds
+        double max;   // Microseconds
+    };
+
+    static bool _enabled = false;
+    static std::array<std::vector<uint64_t>, static_cast<size_t>(Stage::count)> _samples;
+
+    void setEnabled(bool enabled)
+    {
+        _enabled = enabled;
+    }
+
+    bool isEnabled()
+    {
+        return _enabled;
+    }
+
+    void reset()
+    {
+        for (auto& samples : _samples)
+        {
+            samples.clear();
+        }
+    }
+
+    void addSample(Stage stage, std::chrono::nanoseconds duration)
+    {
+        _samples[static_cast<size_t>(stage)].push_back(static_cast<uint64_t>(duration.count()));
+    }
+
+    // Nearest rank percentile, samples must be sorted
+    static uint64_t percentile(const std::vector<uint64_t>& samples, double p)
+    {
+        const auto rank = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+        return samples[std::min(rank, samples.size() - 1)];
+    }
+
+    static StageSummary summarise(Stage stage)
+    {
+        auto samples = _samples[static_cast<size_t>(stage)];
+        if (samples.empty())
+        {
+            return {};
+        }
+        std::sort(samples.begin(), samples.end());
+
+        uint64_t total = 0;
+        for (auto sample : samples)
+        {
+            total += sample;
+        }
+
+        StageSummary summary{};
+        summary.count = samples.size();
+        summary.total = total / 1000.0;
+        summary.p50 = percentile(samples, 0.50) / 1000.0;
+        summary.p95 = percentile(samples, 0.95) / 1000.0;
+        summary.max = samples.back() / 1000.0;
+        return summary;
+    }
+
+    static double ticksPerSecond(const StageSummary& tickSummary)
+    {
+        if (tickSummary.total <= 0.0)
+        {
+            return 0.0;
+        }
+        return tickSummary.count / (tickSummary.total / 1000000.0);
+    }
+
+    void printReport()
+    {
+        const auto tickSummary = summarise(Stage::tick);
+
+        std::printf("Timings (microseconds):\n");
+        std::printf("  %-18s %10s %10s %10s %12s\n", "stage", "p50", "p95", "max", "total");
+        for (size_t i = 0; i < kStageNames.size(); i++)
+        {
+            const auto summary = summarise(static_cast<Stage>(i));
+            std::printf("  %-18s %10.1f %10.1f %10.1f %12.1f\n", kStageNames[i], summary.p50, summary.p95, summary.max, summary.total);
+        }
+        std::printf("  ticks per second: %.1f\n", ticksPerSecond(tickSummary));
+    }
+
+    void writeReport(const fs::path& path)
+    {
+        std::ofstream stream;
+        stream.exceptions(std::ofstream::failbit);
+        stream.open(path, std::ios::out | std::ios::trunc);
+
+        const auto tickSummary = summarise(Stage::tick);
+
+        char buffer[256];
+        stream << "{\n";
+        std::snprintf(buffer, sizeof(buffer), "  \"ticks\": %zu,\n  \"ticksPerSecond\": %.3f,\n", tickSummary.count, ticksPerSecond(tickSummary));
+        stream << buffer;
+        stream << "  \"unit\": \"us\",\n";
+        stream << "  \"stages\": {\n";
+        for (size_t i = 0; i < kStageNames.size(); i++)
+        {
+            const auto summary = summarise(static_cast<Stage>(i));
+            std::snprintf(
+                buffer,
+                sizeof(buffer),
+                "    \"%s\": { \"count\": %zu, \"p50\": %.3f, \"p95\": %.3f, \"max\": %.3f, \"total\": %.3f }%s\n",
+                kStageNames[i],
+                summary.count,
+                summary.p50,
+                summary.p95,
+                summary.max,
+                summary.total,
+                i + 1 < kStageNames.size() ? "," : "");
+            stream << buffer;
+        }
+        stream << "  }\n";
+        stream << "}\n";
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <chrono>
+#include <cstdint>
+
+namespace OpenLoco::TickProfiler
+{
+    // Stages of tickLogic that are timed individually when profiling is enabled
+    enum class Stage : uint8_t
+    {
+        tick, // The whole of tickLogic, used for ticks per second
+        gameCommands,
+        tileReorganise,
+        dateTick,
+        tileManager,
+        waveManager,
+        townManager,
+        industryManager,
+        vehicleManager,
+        stationManager,
+        effectsManager,
+        companyManager,
+        animationManager,
+        audio,
+        title,
+        count,
+    };
+
+    void setEnabled(bool enabled);
+    bool isEnabled();
+    void reset();
+
+    void addSample(Stage stage, std::chrono::nanoseconds duration);
+
+    class ScopedStage
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        Stage _stage;
+        bool _enabled;
+        Clock::time_point _start;
+
+    public:
+        explicit ScopedStage(Stage stage)
+            : _stage(stage)
+            , _enabled(isEnabled())
+        {
+            if (_enabled)
+            {
+                _start = Clock::now();
+            }
+        }
+
+        ~ScopedStage()
+        {
+            if (_enabled)
+            {
+                addSample(_stage, Clock::now() - _start);
+            }
+        }
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+    };
+
+    // Runs func and records its wall time against stage
+    template<typename TFunc>
+    void measure(Stage stage, TFunc&& func)
+    {
+        ScopedStage scope(stage);
+        func();
+    }
+
+    void printReport();
+    void writeReport(const fs::path& path);
+}
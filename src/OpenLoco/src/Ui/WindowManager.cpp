@@ -1763,6 +1763,12 @@ namespace OpenLoco::Ui::WindowManager
             to += stride;
             from += stride;
         }
+
+        // The moved pixels were not rendered, so they are not converted for presenting otherwise
+        if (width > 0 && height > 0)
+        {
+            Gfx::getDrawingEngine().invalidatePresent(Rect(x, y, width, height));
+        }
     }
 
     /**
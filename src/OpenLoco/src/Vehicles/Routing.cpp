@@ -11,6 +11,8 @@
 #include "ViewportManager.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace OpenLoco::Vehicles
 {
@@ -24,12 +26,12 @@ namespace OpenLoco::Vehicles
         CompanyId company;
         uint8_t trackType;
 
-        bool operator==(const LocationOfInterest& rhs)
+        bool operator==(const LocationOfInterest& rhs) const
         {
             return (loc == rhs.loc) && (trackAndDirection == rhs.trackAndDirection) && (company == rhs.company) && (trackType == rhs.trackType);
         }
 
-        bool operator!=(const LocationOfInterest& rhs)
+        bool operator!=(const LocationOfInterest& rhs) const
         {
             return !(*this == rhs);
         }
@@ -40,6 +42,10 @@ namespace OpenLoco::Vehicles
         }
     };
 
+    // Open addressing hash map of track pieces visited during a flood fill. The map is reused
+    // between searches and cleared in O(1) by bumping a generation counter rather than
+    // resetting every slot. Probing and iteration order match the original so that the
+    // kMaxEntries cut off happens at the same location.
     struct LocationOfInterestHashMap
     {
         static constexpr auto kMapSize = 0x400;
@@ -47,20 +53,6 @@ namespace OpenLoco::Vehicles
         static constexpr auto kMaxEntries = 0x39C;
 
     private:
-#pragma pack(push, 1)
-        struct ZAndTD
-        {
-            coord_t z;
-            uint16_t trackAndDirection;
-        };
-        struct CAndT
-        {
-            CompanyId company;
-            uint8_t trackType;
-            uint8_t pad[0x2];
-        };
-#pragma pack(pop)
-
         class Iterator
         {
             uint16_t _index;
@@ -76,7 +68,7 @@ namespace OpenLoco::Vehicles
 
             void findAllocatedEntry()
             {
-                while (_index < kMapSize && _map.locs[_index] == World::Pos2{ -1, -1 })
+                while (_index < kMapSize && !_map.isAllocated(_index))
                 {
                     _index++;
                 }
@@ -105,37 +97,58 @@ namespace OpenLoco::Vehicles
                 return !(*this == other);
             }
 
-            LocationOfInterest operator*() const
+            const LocationOfInterest& operator*() const
             {
                 return _map.get(_index);
             }
             // iterator traits
             using difference_type = std::ptrdiff_t;
             using value_type = LocationOfInterest;
-            using pointer = LocationOfInterest*;
-            using reference = LocationOfInterest&;
+            using pointer = const LocationOfInterest*;
+            using reference = const LocationOfInterest&;
             using iterator_category = std::forward_iterator_tag;
         };
 
-    public:
-#pragma pack(push, 1)
-        World::Pos2 locs[kMapSize];
-        ZAndTD zAndTDs[kMapSize];
-        CAndT cAndTs[kMapSize];
-#pragma pack(pop)
-        size_t count; // count does not need to be tightly packed as this is only accessed via a pointer to first 3 members
+        LocationOfInterest _entries[kMapSize];
+        uint32_t _generations[kMapSize];
+        uint32_t _generation;
+        size_t _count;
 
+    public:
         LocationOfInterestHashMap()
-            : zAndTDs{}
-            , cAndTs{}
-            , count()
+            : _entries{}
+            , _generations{}
+            , _generation(1)
+            , _count()
         {
-            std::fill(std::begin(locs), std::end(locs), World::Pos2{ -1, -1 });
         }
 
-        LocationOfInterest get(const uint16_t index) const
+        // Invalidates all entries without touching them
+        void clear()
         {
-            return LocationOfInterest{ World::Pos3(locs[index].x, locs[index].y, zAndTDs[index].z), zAndTDs[index].trackAndDirection, cAndTs[index].company, cAndTs[index].trackType };
+            _count = 0;
+            _generation++;
+            if (_generation == 0)
+            {
+                // Generation counter wrapped so stale entries could look allocated
+                std::fill(std::begin(_generations), std::end(_generations), 0);
+                _generation = 1;
+            }
+        }
+
+        bool isAllocated(const uint16_t index) const
+        {
+            return _generations[index] == _generation;
+        }
+
+        const LocationOfInterest& get(const uint16_t index) const
+        {
+            return _entries[index];
+        }
+
+        size_t size() const
+        {
+            return _count;
         }
 
         constexpr uint16_t hash(const LocationOfInterest& interest) const
@@ -144,24 +157,23 @@ namespace OpenLoco::Vehicles
         }
 
         // 0x004A38DE
-        bool tryAdd(LocationOfInterest& interest)
+        bool tryAdd(const LocationOfInterest& interest)
         {
             auto index = hash(interest);
-            for (; locs[index] != World::Pos2{ -1, -1 }; ++index, index &= kMapSizeMask)
+            for (; isAllocated(index); ++index, index &= kMapSizeMask)
             {
                 if (get(index) == interest)
                 {
                     return false;
                 }
             }
-            if (count >= kMaxEntries)
+            if (_count >= kMaxEntries)
             {
                 return false;
             }
-            locs[index] = interest.loc;
-            zAndTDs[index] = ZAndTD{ interest.loc.z, interest.trackAndDirection };
-            cAndTs[index] = CAndT{ interest.company, interest.trackType, {} };
-            count++;
+            _entries[index] = interest;
+            _generations[index] = _generation;
+            _count++;
             return true;
         }
 
@@ -175,6 +187,21 @@ namespace OpenLoco::Vehicles
         }
     };
 
+    enum class TrackSearchType : uint8_t
+    {
+        trackPieces,
+        trackInBlock,
+    };
+
+    struct TrackSearchItem
+    {
+        LocationOfInterest interest;
+        TrackSearchType type;
+    };
+
+    // Explicit work stack for the flood fill, replaces the original recursion
+    using TrackSearchStack = std::vector<TrackSearchItem>;
+
     using FilterFunction = bool (*)(const LocationOfInterest& interest);
     using TransformFunction = void (*)(const LocationOfInterestHashMap& hashMap);
 
@@ -186,7 +213,6 @@ namespace OpenLoco::Vehicles
     static loco_global<uint16_t, 0x01135FA6> _1135FA6;
     static loco_global<TransformFunction, 0x01135F12> _transformFunction;
     static loco_global<uint8_t, 0x01136085> _1136085;
-    static loco_global<LocationOfInterestHashMap*, 0x01135F06> _1135F06;
     static loco_global<uint8_t[2], 0x0113601A> _113601A;
     static loco_global<uint16_t, 0x001135F88> _routingTransformData;
 
@@ -502,15 +528,22 @@ namespace OpenLoco::Vehicles
         return true;
     }
 
-    static void findAllUsableTrackInBlock(const LocationOfInterest& initialInterest, const FilterFunction filterFunction, LocationOfInterestHashMap& hashMap);
+    static LocationOfInterestHashMap _interestMap;
+    static TrackSearchStack _trackSearchStack;
+
+    // Reverses the work pushed since stackStart so that it is popped in the order it was found
+    static void reverseNewWork(TrackSearchStack& workStack, const size_t stackStart)
+    {
+        std::reverse(workStack.begin() + stackStart, workStack.end());
+    }
 
     // 0x004A313B
     // Iterates all individual tiles of a track piece to find tracks that need inspection
-    static void findAllUsableTrackPieces(const LocationOfInterest& interest, const FilterFunction filterFunction, LocationOfInterestHashMap& hashMap)
+    static void findAllUsableTrackPieces(const LocationOfInterest& interest, const FilterFunction filterFunction, LocationOfInterestHashMap& hashMap, TrackSearchStack& workStack)
     {
         if (!(_1135FA6 & (1 << 2)))
         {
-            findAllUsableTrackInBlock(interest, filterFunction, hashMap);
+            workStack.push_back(TrackSearchItem{ interest, TrackSearchType::trackInBlock });
             return;
         }
 
@@ -526,7 +559,7 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        std::vector<LocationOfInterest> trackToCheck;
+        const auto stackStart = workStack.size();
 
         for (auto& piece : World::TrackData::getTrackPiece(tad.id()))
         {
@@ -576,7 +609,7 @@ namespace OpenLoco::Vehicles
                 {
                     if (!filterFunction(newInterest))
                     {
-                        trackToCheck.push_back(newInterest);
+                        workStack.push_back(TrackSearchItem{ newInterest, TrackSearchType::trackPieces });
                     }
                 }
 
@@ -594,28 +627,25 @@ namespace OpenLoco::Vehicles
                 {
                     if (!filterFunction(newInterestR))
                     {
-                        trackToCheck.push_back(newInterestR);
+                        workStack.push_back(TrackSearchItem{ newInterestR, TrackSearchType::trackPieces });
                     }
                 }
             }
         }
 
-        findAllUsableTrackInBlock(interest, filterFunction, hashMap);
-
-        for (auto& interest2 : trackToCheck)
-        {
-            findAllUsableTrackPieces(interest2, filterFunction, hashMap);
-        }
+        // The block search of this piece is processed first followed by the pieces found above
+        reverseNewWork(workStack, stackStart);
+        workStack.push_back(TrackSearchItem{ interest, TrackSearchType::trackInBlock });
     }
 
     // 0x004A2FE6
-    static void findAllUsableTrackInBlock(const LocationOfInterest& initialInterest, const FilterFunction filterFunction, LocationOfInterestHashMap& hashMap)
+    static void findAllUsableTrackInBlock(const LocationOfInterest& initialInterest, const FilterFunction filterFunction, LocationOfInterestHashMap& hashMap, TrackSearchStack& workStack)
     {
         World::Track::TrackConnections connections{};
         _113601A[0] = 0;
         _113601A[1] = 0;
         connections.size = 0;
-        std::vector<LocationOfInterest> trackToCheck;
+        const auto stackStart = workStack.size();
 
         const auto [trackEndLoc, trackEndRotation] = World::Track::getTrackConnectionEnd(initialInterest.loc, initialInterest.tad()._data);
         World::Track::getTrackConnections(trackEndLoc, trackEndRotation, connections, initialInterest.company, initialInterest.trackType);
@@ -630,7 +660,7 @@ namespace OpenLoco::Vehicles
                 {
                     if (!filterFunction(interest))
                     {
-                        trackToCheck.push_back(interest);
+                        workStack.push_back(TrackSearchItem{ interest, TrackSearchType::trackPieces });
                     }
                 }
             }
@@ -662,15 +692,35 @@ namespace OpenLoco::Vehicles
                 {
                     if (!filterFunction(interest))
                     {
-                        trackToCheck.push_back(interest);
+                        workStack.push_back(TrackSearchItem{ interest, TrackSearchType::trackPieces });
                     }
                 }
             }
         }
 
-        for (auto& interest : trackToCheck)
+        reverseNewWork(workStack, stackStart);
+    }
+
+    // Depth first flood fill of all track reachable from initialInterest. Uses an explicit
+    // work stack that visits track in the same order as the original recursive implementation.
+    static void findAllUsableTrack(const LocationOfInterest& initialInterest, const FilterFunction filterFunction, LocationOfInterestHashMap& hashMap)
+    {
+        auto& workStack = _trackSearchStack;
+        workStack.clear();
+        workStack.push_back(TrackSearchItem{ initialInterest, TrackSearchType::trackInBlock });
+        while (!workStack.empty())
         {
-            findAllUsableTrackPieces(interest, filterFunction, hashMap);
+            const auto item = workStack.back();
+            workStack.pop_back();
+            switch (item.type)
+            {
+                case TrackSearchType::trackPieces:
+                    findAllUsableTrackPieces(item.interest, filterFunction, hashMap, workStack);
+                    break;
+                case TrackSearchType::trackInBlock:
+                    findAllUsableTrackInBlock(item.interest, filterFunction, hashMap, workStack);
+                    break;
+            }
         }
     }
 
@@ -679,11 +729,11 @@ namespace OpenLoco::Vehicles
     {
         _filterFunction = filterFunction;
         _transformFunction = transformFunction;
-        LocationOfInterestHashMap interestMap{};
-        _1135F06 = &interestMap;
+        auto& interestMap = _interestMap;
+        interestMap.clear();
         _1135F0A = 0;
         _1135FA6 = 5; // flags
-        findAllUsableTrackInBlock(LocationOfInterest{ loc, trackAndDirection._data, company, trackType }, filterFunction, interestMap);
+        findAllUsableTrack(LocationOfInterest{ loc, trackAndDirection._data, company, trackType }, filterFunction, interestMap);
         if (reinterpret_cast<uint32_t>(transformFunction) != 0xFFFFFFFF)
         {
             transformFunction(interestMap);
@@ -17,7 +17,10 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Core/ThreadPool.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -283,8 +286,7 @@ namespace OpenLoco::Ui
         auto alignedX = zoomViewRt.x & ~0x1F;
 
         // Drawing is performed in columns of 32 pixels (1 tile wide)
-
-        // Generate and sort columns.
+        std::vector<Gfx::RenderTarget> columnRts;
         for (auto columnX = alignedX; columnX < rightBorder; columnX += 32)
         {
             Gfx::RenderTarget columnRt = zoomViewRt;
@@ -306,31 +308,68 @@ namespace OpenLoco::Ui
             }
 
             columnRt.width = paintRight - columnRt.x;
+            columnRts.push_back(columnRt);
+        }
+
+        // Columns cover separate pixels so they can be drawn in parallel. Generating the paint
+        // structs still has to happen one column at a time on the global paint session, so the
+        // columns are generated in batches and each batch is drawn across the thread pool.
+        auto& threadPool = Core::ThreadPool::getShared();
+        const size_t batchSize = threadPool.size() * 4;
+        static std::vector<Paint::DetachedPaintSession> sessions;
+        if (sessions.size() < batchSize)
+        {
+            sessions.resize(batchSize);
+        }
 
-            drawingCtx.clearSingle(columnRt, fillColour);
-            auto* sess = Paint::allocateSession(columnRt, options);
-            sess->generate();
-            sess->arrangeStructs();
-            sess->drawStructs();
-            // Climate code used to draw here.
+        for (size_t batchStart = 0; batchStart < columnRts.size(); batchStart += batchSize)
+        {
+            const auto batchCount = std::min(batchSize, columnRts.size() - batchStart);
 
-            if (!isTitleMode())
+            // Generate and sort columns.
+            for (size_t i = 0; i < batchCount; i++)
             {
-                if (!options.hasFlags(ViewportFlags::station_names_displayed))
+                auto* sess = Paint::allocateSession(columnRts[batchStart + i], options);
+                sess->generate();
+                sessions[i].detach(*sess);
+            }
+
+            threadPool.parallelFor(batchCount, [&](size_t i) {
+                drawingCtx.clearSingle(columnRts[batchStart + i], fillColour);
+                sessions[i].arrangeStructs();
+                if (!sessions[i].hasMaskedImages())
                 {
-                    if (columnRt.zoomLevel <= Config::get().old.stationNamesMinScale)
-                    {
-                        drawStationNames(columnRt);
-                    }
+                    sessions[i].drawStructs();
                 }
-                if (!options.hasFlags(ViewportFlags::town_names_displayed))
+            });
+
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                auto& columnRt = columnRts[batchStart + i];
+                if (sessions[i].hasMaskedImages())
                 {
-                    drawTownNames(columnRt);
+                    sessions[i].drawStructs();
+                }
+                // Climate code used to draw here.
+
+                if (!isTitleMode())
+                {
+                    if (!options.hasFlags(ViewportFlags::station_names_displayed))
+                    {
+                        if (columnRt.zoomLevel <= Config::get().old.stationNamesMinScale)
+                        {
+                            drawStationNames(columnRt);
+                        }
+                    }
+                    if (!options.hasFlags(ViewportFlags::town_names_displayed))
+                    {
+                        drawTownNames(columnRt);
+                    }
                 }
-            }
 
-            sess->drawStringStructs();
-            drawRoutingNumbers(columnRt);
+                sessions[i].drawStringStructs();
+                drawRoutingNumbers(columnRt);
+            }
         }
     }
 
@@ -24,6 +24,9 @@
 #include "World/IndustryManager.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -76,6 +79,7 @@ namespace OpenLoco::Ui::Windows::IndustryList
         static constexpr Ui::Size kMinDimensions = { 192, 100 };
 
         static constexpr uint8_t kRowHeight = 10;
+        static constexpr uint16_t kResortInterval = 32;
 
         enum widx
         {
@@ -215,34 +219,29 @@ namespace OpenLoco::Ui::Windows::IndustryList
             self.invalidate();
         }
 
-        // 0x00457A52
-        static bool orderByName(const OpenLoco::Industry& lhs, const OpenLoco::Industry& rhs)
+        struct SortRow
         {
-            char lhsString[256] = { 0 };
-            StringManager::formatString(lhsString, lhs.name, (void*)&lhs.town);
-
-            char rhsString[256] = { 0 };
-            StringManager::formatString(rhsString, rhs.name, (void*)&rhs.town);
+            IndustryId id;
+            std::string key; // Name or status, only formatted when sorting by them
+        };
 
-            return strcmp(lhsString, rhsString) < 0;
+        // 0x00457A52
+        static std::string getNameSortKey(const OpenLoco::Industry& industry)
+        {
+            char buffer[256] = { 0 };
+            StringManager::formatString(buffer, industry.name, (void*)&industry.town);
+            return buffer;
         }
 
         // 0x00457A9F
-        static bool orderByStatus(OpenLoco::Industry& lhs, OpenLoco::Industry& rhs)
+        static std::string getStatusSortKey(OpenLoco::Industry& industry)
         {
-            char lhsString[256] = { 0 };
-            const char* lhsBuffer = StringManager::getString(StringIds::buffer_1250);
-            lhs.getStatusString((char*)lhsBuffer);
+            char buffer[256] = { 0 };
+            const char* statusBuffer = StringManager::getString(StringIds::buffer_1250);
+            industry.getStatusString((char*)statusBuffer);
 
-            StringManager::formatString(lhsString, StringIds::buffer_1250);
-
-            char rhsString[256] = { 0 };
-            const char* rhsBuffer = StringManager::getString(StringIds::buffer_1250);
-            rhs.getStatusString((char*)rhsBuffer);
-
-            StringManager::formatString(rhsString, StringIds::buffer_1250);
-
-            return strcmp(lhsString, rhsString) < 0;
+            StringManager::formatString(buffer, StringIds::buffer_1250);
+            return buffer;
         }
 
         static uint8_t getAverageTransportedCargo(const OpenLoco::Industry& industry)
@@ -277,80 +276,75 @@ namespace OpenLoco::Ui::Windows::IndustryList
         }
 
         // 0x00457A52, 0x00457A9F, 0x00457AF3
-        static bool getOrder(const SortMode mode, OpenLoco::Industry& lhs, OpenLoco::Industry& rhs)
+        static bool getOrder(const SortMode mode, const SortRow& lhs, const SortRow& rhs)
         {
             switch (mode)
             {
                 case SortMode::Name:
-                    return orderByName(lhs, rhs);
-
                 case SortMode::Status:
-                    return orderByStatus(lhs, rhs);
+                    return lhs.key < rhs.key;
 
                 case SortMode::ProductionTransported:
-                    return orderByProductionTransported(lhs, rhs);
+                    return orderByProductionTransported(*IndustryManager::get(lhs.id), *IndustryManager::get(rhs.id));
             }
 
             return false;
         }
 
         // 0x00457991
-        static void updateIndustryList(Window* self)
+        static void sortIndustryList(Window* self)
         {
-            auto chosenIndustry = IndustryId::null;
+            const auto sortMode = SortMode(self->sortMode);
 
+            std::vector<SortRow> rows;
             for (auto& industry : IndustryManager::industries())
             {
-                if (industry.hasFlags(IndustryFlags::sorted))
-                    continue;
+                if (rows.size() >= std::size(self->rowInfo))
+                    break;
 
-                if (chosenIndustry == IndustryId::null)
+                SortRow row{ industry.id(), {} };
+                if (sortMode == SortMode::Name)
                 {
-                    chosenIndustry = industry.id();
-                    continue;
+                    row.key = getNameSortKey(industry);
                 }
-
-                if (getOrder(SortMode(self->sortMode), industry, *IndustryManager::get(chosenIndustry)))
+                else if (sortMode == SortMode::Status)
                 {
-                    chosenIndustry = industry.id();
+                    row.key = getStatusSortKey(industry);
                 }
+                rows.push_back(std::move(row));
             }
 
-            if (chosenIndustry != IndustryId::null)
-            {
-                bool shouldInvalidate = false;
-
-                IndustryManager::get(chosenIndustry)->flags |= IndustryFlags::sorted;
-
-                auto ebp = self->rowCount;
-                if (chosenIndustry != IndustryId(self->rowInfo[ebp]))
-                {
-                    self->rowInfo[ebp] = enumValue(chosenIndustry);
-                    shouldInvalidate = true;
-                }
+            // Stable so that equal industries stay in id order
+            std::stable_sort(rows.begin(), rows.end(), [sortMode](const SortRow& lhs, const SortRow& rhs) {
+                return getOrder(sortMode, lhs, rhs);
+            });
 
-                self->rowCount += 1;
-                if (self->rowCount > self->var_83C)
+            bool shouldInvalidate = self->var_83C != rows.size();
+            for (size_t i = 0; i < rows.size(); i++)
+            {
+                if (IndustryId(self->rowInfo[i]) != rows[i].id)
                 {
-                    self->var_83C = self->rowCount;
+                    self->rowInfo[i] = enumValue(rows[i].id);
                     shouldInvalidate = true;
                 }
-
-                if (shouldInvalidate)
-                {
-                    self->invalidate();
-                }
             }
-            else
+
+            self->rowCount = static_cast<uint16_t>(rows.size());
+            self->var_83C = self->rowCount;
+            if (shouldInvalidate)
             {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                    self->invalidate();
-                }
+                self->invalidate();
+            }
+        }
 
-                Common::refreshIndustryList(self);
+        static uint16_t countIndustries()
+        {
+            uint16_t count = 0;
+            for ([[maybe_unused]] auto& industry : IndustryManager::industries())
+            {
+                count++;
             }
+            return count;
         }
 
         // 0x004580AE
@@ -361,10 +355,11 @@ namespace OpenLoco::Ui::Windows::IndustryList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::industryList, self.number, self.currentTab + Common::widx::tab_industry_list);
 
-            // Add three industries every tick.
-            updateIndustryList(&self);
-            updateIndustryList(&self);
-            updateIndustryList(&self);
+            // Sort again when industries are added or removed, and every so often as their values change
+            if (self.frameNo % kResortInterval == 0 || countIndustries() != self.var_83C)
+            {
+                sortIndustryList(&self);
+            }
         }
 
         // 0x00457EE8
@@ -1331,12 +1326,7 @@ namespace OpenLoco::Ui::Windows::IndustryList
         // 0x00457964
         static void refreshIndustryList(Window* window)
         {
-            window->rowCount = 0;
-
-            for (auto& industry : IndustryManager::industries())
-            {
-                industry.flags &= ~IndustryFlags::sorted;
-            }
+            IndustryList::sortIndustryList(window);
         }
 
         static void initEvents()
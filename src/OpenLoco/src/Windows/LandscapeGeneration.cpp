@@ -17,6 +17,10 @@
 #include "World/IndustryManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
 
 using namespace OpenLoco::Interop;
 
@@ -154,9 +158,10 @@ namespace OpenLoco::Ui::Windows::LandscapeGeneration
             start_year_up,
             generate_when_game_starts,
             generate_now,
+            seed,
         };
 
-        const uint64_t enabled_widgets = Common::enabled_widgets | (1 << widx::start_year_up) | (1 << widx::start_year_down) | (1 << widx::generate_when_game_starts) | (1 << widx::generate_now);
+        const uint64_t enabled_widgets = Common::enabled_widgets | (1 << widx::start_year_up) | (1 << widx::start_year_down) | (1 << widx::generate_when_game_starts) | (1 << widx::generate_now) | (1 << widx::seed);
         const uint64_t holdable_widgets = (1 << widx::start_year_up) | (1 << widx::start_year_down);
 
         static Widget widgets[] = {
@@ -164,6 +169,7 @@ namespace OpenLoco::Ui::Windows::LandscapeGeneration
             makeStepperWidgets({ 256, 52 }, { 100, 12 }, WidgetType::combobox, WindowColour::secondary, StringIds::start_year_value),
             makeWidget({ 10, 68 }, { 346, 12 }, WidgetType::checkbox, WindowColour::secondary, StringIds::label_generate_random_landscape_when_game_starts, StringIds::tooltip_generate_random_landscape_when_game_starts),
             makeWidget({ 196, 200 }, { 160, 12 }, WidgetType::button, WindowColour::secondary, StringIds::button_generate_landscape, StringIds::tooltip_generate_random_landscape),
+            makeWidget({ 256, 84 }, { 100, 12 }, WidgetType::button, WindowColour::secondary, StringIds::landscape_seed_value, StringIds::tooltip_landscape_seed),
             widgetEnd()
         };
 
@@ -182,6 +188,13 @@ namespace OpenLoco::Ui::Windows::LandscapeGeneration
                 window.y + window.widgets[widx::start_year].top,
                 Colour::black,
                 StringIds::start_year);
+
+            drawingCtx.drawStringLeft(
+                *rt,
+                window.x + 10,
+                window.y + window.widgets[widx::seed].top,
+                Colour::black,
+                StringIds::landscape_seed);
         }
 
         // 0x0043DB76
@@ -189,7 +202,18 @@ namespace OpenLoco::Ui::Windows::LandscapeGeneration
         {
             Common::prepareDraw(window);
 
-            _commonFormatArgs[0] = S5::getOptions().scenarioStartYear;
+            auto& options = S5::getOptions();
+            auto args = FormatArguments();
+            args.push(options.scenarioStartYear);
+            if (options.seed == 0)
+            {
+                args.push(StringIds::landscape_seed_random);
+            }
+            else
+            {
+                args.push(StringIds::int_32);
+                args.push(options.seed);
+            }
 
             if ((S5::getOptions().scenarioFlags & Scenario::ScenarioFlags::landscapeGenerationDone) == Scenario::ScenarioFlags::none)
             {
@@ -274,6 +298,50 @@ namespace OpenLoco::Ui::Windows::LandscapeGeneration
                 case widx::generate_now:
                     confirmResetLandscape(0);
                     break;
+
+                case widx::seed:
+                {
+                    const auto seed = S5::getOptions().seed;
+                    const auto seedText = seed == 0 ? std::string() : std::to_string(seed);
+                    StringManager::setString(StringIds::buffer_2039, seedText);
+                    TextInput::openTextInput(&window, StringIds::title_landscape_seed, StringIds::prompt_enter_landscape_seed, StringIds::buffer_2039, widgetIndex, nullptr);
+                    break;
+                }
+            }
+        }
+
+        // Seeds are shown as signed 32 bit values so larger ones are not accepted
+        static std::optional<uint32_t> parseSeed(std::string_view input)
+        {
+            uint32_t seed = 0;
+            for (const auto c : input)
+            {
+                if (c < '0' || c > '9')
+                {
+                    return std::nullopt;
+                }
+                seed = seed * 10 + (c - '0');
+                if (seed > static_cast<uint32_t>(std::numeric_limits<int32_t>::max()))
+                {
+                    return std::nullopt;
+                }
+            }
+            return seed;
+        }
+
+        static void textInput(Window& window, WidgetIndex_t callingWidget, const char* input)
+        {
+            if (callingWidget != widx::seed)
+            {
+                return;
+            }
+
+            // An empty seed picks a random one for every landscape
+            const auto seed = parseSeed(input);
+            if (seed.has_value())
+            {
+                S5::getOptions().seed = *seed;
+                window.invalidate();
             }
         }
 
@@ -284,6 +352,7 @@ namespace OpenLoco::Ui::Windows::LandscapeGeneration
             events.onMouseDown = onMouseDown;
             events.onMouseUp = onMouseUp;
             events.onUpdate = Common::update;
+            events.textInput = textInput;
         }
     }
 
@@ -18,6 +18,9 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -28,6 +31,7 @@ namespace OpenLoco::Ui::Windows::StationList
     static constexpr Ui::Size kMinDimensions = { 192, 100 };
 
     static constexpr uint8_t kRowHeight = 10; // CJK: 13
+    static constexpr uint16_t kResortInterval = 32;
 
     enum widx
     {
@@ -128,30 +132,18 @@ namespace OpenLoco::Ui::Windows::StationList
         _events.tooltip = tooltip;
     }
 
-    // 0x004910E8
-    static void refreshStationList(Window* window)
+    struct SortRow
     {
-        window->rowCount = 0;
-
-        for (auto& station : StationManager::stations())
-        {
-            if (station.owner == CompanyId(window->number))
-            {
-                station.flags &= ~StationFlags::flag_4;
-            }
-        }
-    }
+        StationId id;
+        std::string key; // Name or accepted cargo, only formatted when sorting by them
+    };
 
     // 0x004911FD
-    static bool orderByName(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    static std::string getNameSortKey(const OpenLoco::Station& station)
     {
-        char lhsString[256] = { 0 };
-        StringManager::formatString(lhsString, lhs.name, (void*)&lhs.town);
-
-        char rhsString[256] = { 0 };
-        StringManager::formatString(rhsString, rhs.name, (void*)&rhs.town);
-
-        return strcmp(lhsString, rhsString) < 0;
+        char buffer[256] = { 0 };
+        StringManager::formatString(buffer, station.name, (void*)&station.town);
+        return buffer;
     }
 
     // 0x00491281, 0x00491247
@@ -173,118 +165,108 @@ namespace OpenLoco::Ui::Windows::StationList
     }
 
     // 0x004912BB
-    static bool orderByAccepts(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    static std::string getAcceptsSortKey(const OpenLoco::Station& station)
     {
-        char* ptr;
-
-        char lhsString[256] = { 0 };
-        ptr = &lhsString[0];
+        char buffer[256] = { 0 };
+        char* ptr = &buffer[0];
         for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
         {
-            if (lhs.cargoStats[cargoId].isAccepted())
+            if (station.cargoStats[cargoId].isAccepted())
             {
                 ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
             }
         }
-
-        char rhsString[256] = { 0 };
-        ptr = &rhsString[0];
-        for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
-        {
-            if (rhs.cargoStats[cargoId].isAccepted())
-            {
-                ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
-            }
-        }
-
-        return strcmp(lhsString, rhsString) < 0;
+        return buffer;
     }
 
     // 0x004911FD, 0x00491247, 0x00491281, 0x004912BB
-    static bool getOrder(const SortMode mode, const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    static bool getOrder(const SortMode mode, const SortRow& lhs, const SortRow& rhs)
     {
         switch (mode)
         {
             case SortMode::Name:
-                return orderByName(lhs, rhs);
+            case SortMode::CargoAccepted:
+                return lhs.key < rhs.key;
 
             case SortMode::Status:
             case SortMode::TotalUnitsWaiting:
-                return orderByQuantity(lhs, rhs);
-
-            case SortMode::CargoAccepted:
-                return orderByAccepts(lhs, rhs);
+                return orderByQuantity(*StationManager::get(lhs.id), *StationManager::get(rhs.id));
         }
 
         return false;
     }
 
-    // 0x0049111A
-    static void updateStationList(Window* window)
+    static bool isStationListed(const Window& window, const OpenLoco::Station& station)
     {
-        StationId edi = StationId::null;
-
-        for (auto& station : StationManager::stations())
-        {
-            if (station.owner != CompanyId(window->number))
-                continue;
-
-            if ((station.flags & StationFlags::flag_5) != StationFlags::none)
-                continue;
-
-            const StationFlags mask = tabInformationByType[window->currentTab].stationMask;
-            if ((station.flags & mask) == StationFlags::none)
-                continue;
+        if (station.owner != CompanyId(window.number))
+            return false;
 
-            if ((station.flags & StationFlags::flag_4) != StationFlags::none)
-                continue;
+        if ((station.flags & StationFlags::flag_5) != StationFlags::none)
+            return false;
 
-            if (edi == StationId::null)
-            {
-                edi = station.id();
-                continue;
-            }
+        const StationFlags mask = tabInformationByType[window.currentTab].stationMask;
+        return (station.flags & mask) != StationFlags::none;
+    }
 
-            if (getOrder(SortMode(window->sortMode), station, *StationManager::get(edi)))
+    static uint16_t countListedStations(const Window& window)
+    {
+        uint16_t count = 0;
+        for (auto& station : StationManager::stations())
+        {
+            if (isStationListed(window, station))
             {
-                edi = station.id();
+                count++;
             }
         }
+        return count;
+    }
 
-        if (edi != StationId::null)
-        {
-            bool dl = false;
+    // 0x004910E8, 0x0049111A
+    static void refreshStationList(Window* window)
+    {
+        const auto sortMode = SortMode(window->sortMode);
 
-            StationManager::get(edi)->flags |= StationFlags::flag_4;
+        std::vector<SortRow> rows;
+        for (auto& station : StationManager::stations())
+        {
+            if (rows.size() >= std::size(window->rowInfo))
+                break;
 
-            auto ebp = window->rowCount;
-            if (edi != StationId(window->rowInfo[ebp]))
-            {
-                window->rowInfo[ebp] = enumValue(edi);
-                dl = true;
-            }
+            if (!isStationListed(*window, station))
+                continue;
 
-            window->rowCount += 1;
-            if (window->rowCount > window->var_83C)
+            SortRow row{ station.id(), {} };
+            if (sortMode == SortMode::Name)
             {
-                window->var_83C = window->rowCount;
-                dl = true;
+                row.key = getNameSortKey(station);
             }
-
-            if (dl)
+            else if (sortMode == SortMode::CargoAccepted)
             {
-                window->invalidate();
+                row.key = getAcceptsSortKey(station);
             }
+            rows.push_back(std::move(row));
         }
-        else
+
+        // Stable so that equal stations stay in id order
+        std::stable_sort(rows.begin(), rows.end(), [sortMode](const SortRow& lhs, const SortRow& rhs) {
+            return getOrder(sortMode, lhs, rhs);
+        });
+
+        bool shouldInvalidate = window->var_83C != rows.size();
+        for (size_t i = 0; i < rows.size(); i++)
         {
-            if (window->var_83C != window->rowCount)
+            if (StationId(window->rowInfo[i]) != rows[i].id)
             {
-                window->var_83C = window->rowCount;
-                window->invalidate();
+                window->rowInfo[i] = enumValue(rows[i].id);
+                shouldInvalidate = true;
             }
+        }
 
-            refreshStationList(window);
+        window->rowCount = static_cast<uint16_t>(rows.size());
+        window->var_83C = window->rowCount;
+        if (shouldInvalidate)
+        {
+            window->invalidate();
         }
     }
 
@@ -590,13 +572,11 @@ namespace OpenLoco::Ui::Windows::StationList
         window.number = enumValue(companyId);
         window.owner = companyId;
         window.sortMode = 0;
-        window.rowCount = 0;
-
-        refreshStationList(&window);
-
         window.var_83C = 0;
         window.rowHover = -1;
 
+        refreshStationList(&window);
+
         window.callOnResize();
         window.callPrepareDraw();
         window.initScrollWidgets();
@@ -705,10 +685,11 @@ namespace OpenLoco::Ui::Windows::StationList
         window.callPrepareDraw();
         WindowManager::invalidateWidget(WindowType::stationList, window.number, window.currentTab + 4);
 
-        // Add three stations every tick.
-        updateStationList(&window);
-        updateStationList(&window);
-        updateStationList(&window);
+        // Sort again when stations are added or removed, and every so often as their values change
+        if (window.frameNo % kResortInterval == 0 || countListedStations(window) != window.var_83C)
+        {
+            refreshStationList(&window);
+        }
     }
 
     // 0x00491999
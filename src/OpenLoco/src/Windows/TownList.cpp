@@ -23,6 +23,9 @@
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/Numeric.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -81,6 +84,7 @@ namespace OpenLoco::Ui::Windows::TownList
         static constexpr Ui::Size kMinDimensions = { 192, 100 };
 
         static constexpr uint8_t kRowHeight = 10;
+        static constexpr uint16_t kResortInterval = 32;
 
         enum widx
         {
@@ -297,16 +301,18 @@ namespace OpenLoco::Ui::Windows::TownList
             self.invalidate();
         }
 
-        // 0x00499EC9
-        static bool orderByName(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
+        struct SortRow
         {
-            char lhsString[256] = { 0 };
-            StringManager::formatString(lhsString, lhs.name);
-
-            char rhsString[256] = { 0 };
-            StringManager::formatString(rhsString, rhs.name);
+            TownId id;
+            std::string name; // Only formatted when sorting by name
+        };
 
-            return strcmp(lhsString, rhsString) < 0;
+        // 0x00499EC9
+        static std::string getNameSortKey(const OpenLoco::Town& town)
+        {
+            char buffer[256] = { 0 };
+            StringManager::formatString(buffer, town.name);
+            return buffer;
         }
 
         // 0x00499F28
@@ -347,81 +353,76 @@ namespace OpenLoco::Ui::Windows::TownList
         }
 
         // 0x00499EC9, 0x00499F0A, 0x00499F28, 0x00499F3B
-        static bool getOrder(const SortMode mode, OpenLoco::Town& lhs, OpenLoco::Town& rhs)
+        static bool getOrder(const SortMode mode, const SortRow& lhs, const SortRow& rhs)
         {
             switch (mode)
             {
                 case SortMode::Name:
-                    return orderByName(lhs, rhs);
+                    return lhs.name < rhs.name;
 
                 case SortMode::Type:
-                    return orderByType(lhs, rhs);
+                    return orderByType(*TownManager::get(lhs.id), *TownManager::get(rhs.id));
 
                 case SortMode::Population:
-                    return orderByPopulation(lhs, rhs);
+                    return orderByPopulation(*TownManager::get(lhs.id), *TownManager::get(rhs.id));
 
                 case SortMode::Stations:
-                    return orderByStations(lhs, rhs);
+                    return orderByStations(*TownManager::get(lhs.id), *TownManager::get(rhs.id));
             }
 
             return false;
         }
 
         // 0x00499E0B
-        static void updateTownList(Window* self)
+        static void sortTownList(Window* self)
         {
-            TownId chosenTown = TownId::null;
+            const auto sortMode = SortMode(self->sortMode);
+
+            std::vector<SortRow> rows;
             for (auto& town : TownManager::towns())
             {
-                if ((town.flags & TownFlags::sorted) != TownFlags::none)
-                    continue;
-
-                if (chosenTown == TownId::null)
-                {
-                    chosenTown = town.id();
-                    continue;
-                }
+                if (rows.size() >= std::size(self->rowInfo))
+                    break;
 
-                if (getOrder(SortMode(self->sortMode), town, *TownManager::get(chosenTown)))
+                SortRow row{ town.id(), {} };
+                if (sortMode == SortMode::Name)
                 {
-                    chosenTown = town.id();
+                    row.name = getNameSortKey(town);
                 }
+                rows.push_back(std::move(row));
             }
 
-            if (chosenTown != TownId::null)
-            {
-                bool shouldInvalidate = false;
-
-                TownManager::get(chosenTown)->flags |= TownFlags::sorted;
-
-                if (chosenTown != TownId(self->rowInfo[self->rowCount]))
-                {
-                    self->rowInfo[self->rowCount] = enumValue(chosenTown);
-                    shouldInvalidate = true;
-                }
+            // Stable so that equal towns stay in id order
+            std::stable_sort(rows.begin(), rows.end(), [sortMode](const SortRow& lhs, const SortRow& rhs) {
+                return getOrder(sortMode, lhs, rhs);
+            });
 
-                self->rowCount += 1;
-                if (self->rowCount > self->var_83C)
+            bool shouldInvalidate = self->var_83C != rows.size();
+            for (size_t i = 0; i < rows.size(); i++)
+            {
+                if (TownId(self->rowInfo[i]) != rows[i].id)
                 {
-                    self->var_83C = self->rowCount;
+                    self->rowInfo[i] = enumValue(rows[i].id);
                     shouldInvalidate = true;
                 }
-
-                if (shouldInvalidate)
-                {
-                    self->invalidate();
-                }
             }
-            else
+
+            self->rowCount = static_cast<uint16_t>(rows.size());
+            self->var_83C = self->rowCount;
+            if (shouldInvalidate)
             {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                    self->invalidate();
-                }
+                self->invalidate();
+            }
+        }
 
-                Common::refreshTownList(self);
+        static uint16_t countTowns()
+        {
+            uint16_t count = 0;
+            for ([[maybe_unused]] auto& town : TownManager::towns())
+            {
+                count++;
             }
+            return count;
         }
 
         // 0x0049A4A0
@@ -432,10 +433,11 @@ namespace OpenLoco::Ui::Windows::TownList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::townList, self.number, self.currentTab + Common::widx::tab_town_list);
 
-            // Add three towns every tick.
-            updateTownList(&self);
-            updateTownList(&self);
-            updateTownList(&self);
+            // Sort again when towns are added or removed, and every so often as their values change
+            if (self.frameNo % kResortInterval == 0 || countTowns() != self.var_83C)
+            {
+                sortTownList(&self);
+            }
         }
 
         // 0x0049A4D0
@@ -1635,12 +1637,7 @@ namespace OpenLoco::Ui::Windows::TownList
         // 0x00499DDE
         static void refreshTownList(Window* self)
         {
-            self->rowCount = 0;
-
-            for (auto& town : TownManager::towns())
-            {
-                town.flags &= ~TownFlags::sorted;
-            }
+            TownList::sortTownList(self);
         }
 
         static void initEvents()
@@ -23,8 +23,11 @@
 #include "World/StationManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -104,6 +107,8 @@ namespace OpenLoco::Ui::Windows::VehicleList
         transportingCargo,
     };
 
+    static constexpr uint16_t kResortInterval = 32;
+
     static const uint8_t row_heights[] = {
         28,
         28,
@@ -180,41 +185,49 @@ namespace OpenLoco::Ui::Windows::VehicleList
         return false;
     }
 
-    // 0x004C1D4F
-    static void refreshVehicleList(Window* self)
+    struct SortRow
     {
-        refreshActiveStation(self);
-        self->rowCount = 0;
-        for (auto* vehicle : VehicleManager::VehicleList())
-        {
-            if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
-                continue;
+        EntityId id;
+        std::string name; // Only formatted when sorting by name
+    };
 
-            if (vehicle->owner != CompanyId(self->number))
-                continue;
+    static bool isVehicleListed(const Window* self, const VehicleHead* vehicle)
+    {
+        if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
+            return false;
 
-            if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
-                continue;
+        if (vehicle->owner != CompanyId(self->number))
+            return false;
 
-            if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
-                continue;
+        if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
+            return false;
+
+        if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
+            return false;
 
-            vehicle->vehicleFlags &= ~VehicleFlags::sorted;
+        return true;
+    }
+
+    static uint16_t countListedVehicles(const Window* self)
+    {
+        uint16_t count = 0;
+        for (auto* vehicle : VehicleManager::VehicleList())
+        {
+            if (isVehicleListed(self, vehicle))
+            {
+                count++;
+            }
         }
+        return count;
     }
 
     // 0x004C1E4F
-    static bool orderByName(const VehicleHead& lhs, const VehicleHead& rhs)
+    static std::string getNameSortKey(const VehicleHead& vehicle)
     {
-        char lhsString[256] = { 0 };
-        auto args = FormatArguments::common(lhs.ordinalNumber);
-        StringManager::formatString(lhsString, lhs.name, &args);
-
-        char rhsString[256] = { 0 };
-        args = FormatArguments::common(rhs.ordinalNumber);
-        StringManager::formatString(rhsString, rhs.name, &args);
-
-        return Utility::strlogicalcmp(lhsString, rhsString) < 0;
+        char buffer[256] = { 0 };
+        auto args = FormatArguments::common(vehicle.ordinalNumber);
+        StringManager::formatString(buffer, vehicle.name, &args);
+        return buffer;
     }
 
     // 0x004C1EC9
@@ -244,92 +257,61 @@ namespace OpenLoco::Ui::Windows::VehicleList
         return static_cast<int32_t>(reliabilityR - reliabilityL) < 0;
     }
 
-    static bool getOrder(const SortMode mode, const VehicleHead& lhs, const VehicleHead& rhs)
+    static bool getOrder(const SortMode mode, const SortRow& lhs, const SortRow& rhs)
     {
         switch (mode)
         {
             case SortMode::Name:
-                return orderByName(lhs, rhs);
+                return Utility::strlogicalcmp(lhs.name.c_str(), rhs.name.c_str()) < 0;
 
             case SortMode::Profit:
-                return orderByProfit(lhs, rhs);
+                return orderByProfit(*EntityManager::get<VehicleHead>(lhs.id), *EntityManager::get<VehicleHead>(rhs.id));
 
             case SortMode::Age:
-                return orderByAge(lhs, rhs);
+                return orderByAge(*EntityManager::get<VehicleHead>(lhs.id), *EntityManager::get<VehicleHead>(rhs.id));
 
             case SortMode::Reliability:
-                return orderByReliability(lhs, rhs);
+                return orderByReliability(*EntityManager::get<VehicleHead>(lhs.id), *EntityManager::get<VehicleHead>(rhs.id));
         }
 
         return false;
     }
 
-    // 0x004C1D92
-    static void updateVehicleList(Window* self)
+    // 0x004C1D4F, 0x004C1D92
+    static void refreshVehicleList(Window* self)
     {
-        EntityId insertId = EntityId::null;
+        refreshActiveStation(self);
+
+        const auto sortMode = SortMode(self->sortMode);
 
+        std::vector<SortRow> rows;
         for (auto* vehicle : VehicleManager::VehicleList())
         {
-            if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
-                continue;
-
-            if (vehicle->owner != CompanyId(self->number))
-                continue;
-
-            if (vehicle->hasVehicleFlags(VehicleFlags::sorted))
-                continue;
-
-            if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
-                continue;
-
-            if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
-                continue;
+            if (rows.size() >= std::size(self->rowInfo))
+                break;
 
-            if (insertId == EntityId::null)
-            {
-                insertId = vehicle->id;
+            if (!isVehicleListed(self, vehicle))
                 continue;
-            }
 
-            auto* insertVehicle = EntityManager::get<VehicleHead>(insertId);
-            if (insertVehicle == nullptr)
+            SortRow row{ vehicle->id, {} };
+            if (sortMode == SortMode::Name)
             {
-                continue;
-            }
-            if (getOrder(SortMode(self->sortMode), *vehicle, *insertVehicle))
-            {
-                insertId = vehicle->id;
-                continue;
+                row.name = getNameSortKey(*vehicle);
             }
+            rows.push_back(std::move(row));
         }
 
-        if (insertId != EntityId::null)
-        {
-            auto vehicle = EntityManager::get<VehicleHead>(insertId);
-            if (vehicle == nullptr)
-            {
-                self->var_83C = self->rowCount;
-                refreshVehicleList(self);
-                return;
-            }
-            vehicle->vehicleFlags |= VehicleFlags::sorted;
-
-            if (vehicle->id != EntityId(self->rowInfo[self->rowCount]))
-                self->rowInfo[self->rowCount] = enumValue(vehicle->id);
+        // Stable so that equal vehicles stay in list order
+        std::stable_sort(rows.begin(), rows.end(), [sortMode](const SortRow& lhs, const SortRow& rhs) {
+            return getOrder(sortMode, lhs, rhs);
+        });
 
-            self->rowCount++;
-
-            if (self->rowCount > self->var_83C)
-                self->var_83C = self->rowCount;
-        }
-        else
+        for (size_t i = 0; i < rows.size(); i++)
         {
-            if (self->var_83C != self->rowCount)
-                self->var_83C = self->rowCount;
-
-            refreshVehicleList(self);
+            self->rowInfo[i] = enumValue(rows[i].id);
         }
+        self->rowCount = static_cast<uint16_t>(rows.size());
+        self->var_83C = self->rowCount;
     }
 
     // 0x004C2A6E
@@ -823,11 +805,8 @@ namespace OpenLoco::Ui::Windows::VehicleList
         if (self->width < 220)
             self->width = 220;
 
-        self->rowCount = 0;
-        refreshVehicleList(self);
-
-        self->var_83C = 0;
         self->rowHover = -1;
+        refreshVehicleList(self);
 
         self->callOnResize();
         self->callOnPeriodicUpdate();
@@ -943,11 +922,8 @@ namespace OpenLoco::Ui::Windows::VehicleList
 
         disableUnavailableVehicleTypes(self);
 
-        self->rowCount = 0;
-        refreshVehicleList(self);
-
-        self->var_83C = 0;
         self->rowHover = -1;
+        refreshVehicleList(self);
 
         self->callOnResize();
         self->callPrepareDraw();
@@ -973,6 +949,8 @@ namespace OpenLoco::Ui::Windows::VehicleList
         {
             self.var_88C = Dropdown::getItemArgument(itemIndex, 3);
         }
+
+        refreshVehicleList(&self);
     }
 
     // 0x004C24CA
@@ -992,9 +970,11 @@ namespace OpenLoco::Ui::Windows::VehicleList
         auto widgetIndex = getTabFromType(static_cast<VehicleType>(self.currentTab));
         WindowManager::invalidateWidget(WindowType::vehicleList, self.number, widgetIndex);
 
-        updateVehicleList(&self);
-        updateVehicleList(&self);
-        updateVehicleList(&self);
+        // Sort again when vehicles are added or removed, and every so often as their values change
+        if (self.frameNo % kResortInterval == 0 || countListedVehicles(&self) != self.var_83C)
+        {
+            refreshVehicleList(&self);
+        }
 
         self.invalidate();
     }
@@ -626,6 +626,7 @@ namespace OpenLoco
             elBuilding->setVariation(variation);
             elBuilding->setAge(0);
             elBuilding->setConstructed(false);
+            invalidateTileCargo(pos);
             elBuilding->setUnk5u(0);
 
             Ui::ViewportManager::invalidate(pos, elBuilding->baseHeight(), elBuilding->clearHeight());
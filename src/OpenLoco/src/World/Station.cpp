@@ -18,10 +18,13 @@
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include "ViewportManager.h"
+#include <OpenLoco/Core/Span.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Math/Bound.hpp>
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -44,6 +47,10 @@ namespace OpenLoco
         inline static loco_global<IndustryId[kMaxCargoStats], 0x0112C7D2> _industry;
         inline static loco_global<uint8_t, 0x0112C7F2> _byte_112C7F2;
 
+        // Indices of every tile that has been given CatchmentFlags::flag_1 so the search does not
+        // have to scan the whole map. May contain duplicates until sortCatchmentTiles is called.
+        inline static std::vector<uint32_t> _catchmentTiles;
+
     public:
         bool mapHas2(const tile_coord_t x, const tile_coord_t y) const
         {
@@ -105,6 +112,35 @@ namespace OpenLoco
             }
         }
 
+        void addCatchmentRegion(tile_coord_t x, tile_coord_t y, int16_t xTileCount, int16_t yTileCount)
+        {
+            for (auto yEnd = y + yTileCount; y < yEnd; y++)
+            {
+                for (auto i = 0; i < xTileCount; i++)
+                {
+                    _catchmentTiles.push_back(y * kMapColumns + x + i);
+                }
+            }
+        }
+
+        // Sorts into map order (the order the full map scan used to visit the tiles) and removes duplicates
+        const std::vector<uint32_t>& sortCatchmentTiles()
+        {
+            std::sort(_catchmentTiles.begin(), _catchmentTiles.end());
+            _catchmentTiles.erase(std::unique(_catchmentTiles.begin(), _catchmentTiles.end()), _catchmentTiles.end());
+            return _catchmentTiles;
+        }
+
+        // Clears CatchmentFlags::flag_1 from all tiles in the catchment list
+        void resetCatchmentTiles()
+        {
+            for (auto index : _catchmentTiles)
+            {
+                _map[index] &= ~(1 << enumValue(CatchmentFlags::flag_1));
+            }
+            _catchmentTiles.clear();
+        }
+
         uint32_t filter() const
         {
             return _filter;
@@ -229,6 +265,204 @@ namespace OpenLoco
         }
     }
 
+    // The elements of a tile that can take part in the cargo search. Only the element state is
+    // cached, industry state and object data are looked up when the cargo is added.
+    struct TileCargoEntry
+    {
+        ElementType type;
+        uint8_t id; // IndustryId for industries, object id for buildings
+        uint8_t multiTileIndex;
+    };
+
+    struct TileCargo
+    {
+        static constexpr uint8_t kMaxEntries = 3;
+        static constexpr uint8_t kUncachable = 0xFF;
+
+        uint16_t epoch; // Only valid if equal to _tileCargoEpoch
+        uint8_t numEntries;
+        std::array<TileCargoEntry, kMaxEntries> entries;
+    };
+
+    static std::vector<TileCargo> _tileCargo;
+    static uint16_t _tileCargoEpoch = 1;
+
+    void invalidateTileCargo(const TilePos2& pos)
+    {
+        if (!_tileCargo.empty() && validCoords(pos))
+        {
+            _tileCargo[pos.y * kMapColumns + pos.x].epoch = 0;
+        }
+    }
+
+    void invalidateAllTileCargo()
+    {
+        _tileCargoEpoch++;
+        if (_tileCargoEpoch == 0)
+        {
+            // Epoch wrapped around, old entries could become valid again
+            for (auto& tileCargo : _tileCargo)
+            {
+                tileCargo.epoch = 0;
+            }
+            _tileCargoEpoch = 1;
+        }
+    }
+
+    static void getTileCargoEntries(const TilePos2& pos, std::vector<TileCargoEntry>& entries)
+    {
+        entries.clear();
+        auto tile = TileManager::get(pos);
+        for (auto& el : tile)
+        {
+            if (el.isGhost())
+            {
+                continue;
+            }
+            switch (el.type())
+            {
+                case ElementType::industry:
+                {
+                    auto& industryEl = el.get<IndustryElement>();
+                    entries.push_back(TileCargoEntry{ ElementType::industry, enumValue(industryEl.industryId()), 0 });
+                    break;
+                }
+                case ElementType::building:
+                {
+                    auto& buildingEl = el.get<BuildingElement>();
+                    if (buildingEl.has_40() || !buildingEl.isConstructed())
+                    {
+                        break;
+                    }
+                    entries.push_back(TileCargoEntry{ ElementType::building, buildingEl.objectId(), buildingEl.multiTileIndex() });
+                    break;
+                }
+                default:
+                    continue;
+            }
+        }
+    }
+
+    static void addTileCargo(CargoSearchState& cargoSearchState, const TilePos2& pos)
+    {
+        static std::vector<TileCargoEntry> tileEntries;
+
+        if (_tileCargo.empty())
+        {
+            _tileCargo.resize(kMapSize);
+        }
+
+        stdx::span<const TileCargoEntry> entries;
+        auto& tileCargo = _tileCargo[pos.y * kMapColumns + pos.x];
+        if (tileCargo.epoch == _tileCargoEpoch && tileCargo.numEntries != TileCargo::kUncachable)
+        {
+            entries = stdx::span<const TileCargoEntry>(tileCargo.entries.data(), tileCargo.numEntries);
+        }
+        else
+        {
+            getTileCargoEntries(pos, tileEntries);
+            entries = tileEntries;
+
+            tileCargo.epoch = _tileCargoEpoch;
+            if (tileEntries.size() <= TileCargo::kMaxEntries)
+            {
+                tileCargo.numEntries = static_cast<uint8_t>(tileEntries.size());
+                std::copy(tileEntries.begin(), tileEntries.end(), tileCargo.entries.begin());
+            }
+            else
+            {
+                tileCargo.numEntries = TileCargo::kUncachable;
+            }
+        }
+
+        for (const auto& entry : entries)
+        {
+            switch (entry.type)
+            {
+                case ElementType::industry:
+                {
+                    auto* industry = IndustryManager::get(IndustryId(entry.id));
+
+                    if (industry == nullptr || industry->under_construction != 0xFF)
+                    {
+                        break;
+                    }
+                    const auto* obj = industry->getObject();
+
+                    if (obj == nullptr)
+                    {
+                        break;
+                    }
+
+                    for (auto cargoId : obj->requiredCargoType)
+                    {
+                        if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
+                        {
+                            cargoSearchState.addScore(cargoId, 8);
+                            cargoSearchState.setIndustry(cargoId, industry->id());
+                        }
+                    }
+
+                    for (auto cargoId : obj->producedCargoType)
+                    {
+                        if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
+                        {
+                            cargoSearchState.addProducedCargoType(cargoId);
+                        }
+                    }
+
+                    break;
+                }
+                case ElementType::building:
+                {
+                    const auto* obj = ObjectManager::get<BuildingObject>(entry.id);
+
+                    if (obj == nullptr)
+                    {
+                        break;
+                    }
+                    for (int i = 0; i < 2; i++)
+                    {
+                        const auto cargoId = obj->producedCargoType[i];
+                        if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
+                        {
+                            cargoSearchState.addScore(cargoId, obj->var_A6[i]);
+
+                            if (obj->producedQuantity[i] != 0)
+                            {
+                                cargoSearchState.addProducedCargoType(cargoId);
+                            }
+                        }
+                    }
+
+                    for (int i = 0; i < 2; i++)
+                    {
+                        if (obj->var_A4[i] != 0xFF && (cargoSearchState.filter() & (1 << obj->var_A4[i])))
+                        {
+                            cargoSearchState.addScore(obj->var_A4[i], obj->var_A8[i]);
+                        }
+                    }
+
+                    // Multi tile buildings should only be counted once so remove the other tiles from the search
+                    if (obj->hasFlags(BuildingObjectFlags::largeTile))
+                    {
+                        tile_coord_t xPos = pos.x - World::offsets[entry.multiTileIndex].x / kTileSize;
+                        tile_coord_t yPos = pos.y - World::offsets[entry.multiTileIndex].y / kTileSize;
+
+                        cargoSearchState.mapRemove2(xPos + 0, yPos + 0);
+                        cargoSearchState.mapRemove2(xPos + 0, yPos + 1);
+                        cargoSearchState.mapRemove2(xPos + 1, yPos + 0);
+                        cargoSearchState.mapRemove2(xPos + 1, yPos + 1);
+                    }
+
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+
     // 0x00492026
     static uint32_t doCalcAcceptedCargo(const Station* station, CargoSearchState& cargoSearchState)
     {
@@ -274,115 +508,13 @@ namespace OpenLoco
             cargoSearchState.filter(~0);
         }
 
-        for (tile_coord_t ty = 0; ty < kMapColumns; ty++)
+        for (auto index : cargoSearchState.sortCatchmentTiles())
         {
-            for (tile_coord_t tx = 0; tx < kMapRows; tx++)
+            const auto tx = static_cast<tile_coord_t>(index % kMapColumns);
+            const auto ty = static_cast<tile_coord_t>(index / kMapColumns);
+            if (cargoSearchState.mapHas2(tx, ty))
             {
-                if (cargoSearchState.mapHas2(tx, ty))
-                {
-                    auto pos = Pos2(tx * kTileSize, ty * kTileSize);
-                    auto tile = TileManager::get(pos);
-
-                    for (auto& el : tile)
-                    {
-                        if (el.isGhost())
-                        {
-                            continue;
-                        }
-                        switch (el.type())
-                        {
-                            case ElementType::industry:
-                            {
-                                auto& industryEl = el.get<IndustryElement>();
-                                auto* industry = industryEl.industry();
-
-                                if (industry == nullptr || industry->under_construction != 0xFF)
-                                {
-                                    break;
-                                }
-                                const auto* obj = industry->getObject();
-
-                                if (obj == nullptr)
-                                {
-                                    break;
-                                }
-
-                                for (auto cargoId : obj->requiredCargoType)
-                                {
-                                    if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
-                                    {
-                                        cargoSearchState.addScore(cargoId, 8);
-                                        cargoSearchState.setIndustry(cargoId, industry->id());
-                                    }
-                                }
-
-                                for (auto cargoId : obj->producedCargoType)
-                                {
-                                    if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
-                                    {
-                                        cargoSearchState.addProducedCargoType(cargoId);
-                                    }
-                                }
-
-                                break;
-                            }
-                            case ElementType::building:
-                            {
-                                auto& buildingEl = el.get<BuildingElement>();
-
-                                if (buildingEl.has_40() || !buildingEl.isConstructed())
-                                {
-                                    break;
-                                }
-
-                                const auto* obj = buildingEl.getObject();
-
-                                if (obj == nullptr)
-                                {
-                                    break;
-                                }
-                                for (int i = 0; i < 2; i++)
-                                {
-                                    const auto cargoId = obj->producedCargoType[i];
-                                    if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
-                                    {
-                                        cargoSearchState.addScore(cargoId, obj->var_A6[i]);
-
-                                        if (obj->producedQuantity[i] != 0)
-                                        {
-                                            cargoSearchState.addProducedCargoType(cargoId);
-                                        }
-                                    }
-                                }
-
-                                for (int i = 0; i < 2; i++)
-                                {
-                                    if (obj->var_A4[i] != 0xFF && (cargoSearchState.filter() & (1 << obj->var_A4[i])))
-                                    {
-                                        cargoSearchState.addScore(obj->var_A4[i], obj->var_A8[i]);
-                                    }
-                                }
-
-                                // Multi tile buildings should only be counted once so remove the other tiles from the search
-                                if (obj->hasFlags(BuildingObjectFlags::largeTile))
-                                {
-                                    auto index = buildingEl.multiTileIndex();
-                                    tile_coord_t xPos = (pos.x - World::offsets[index].x) / kTileSize;
-                                    tile_coord_t yPos = (pos.y - World::offsets[index].y) / kTileSize;
-
-                                    cargoSearchState.mapRemove2(xPos + 0, yPos + 0);
-                                    cargoSearchState.mapRemove2(xPos + 0, yPos + 1);
-                                    cargoSearchState.mapRemove2(xPos + 1, yPos + 0);
-                                    cargoSearchState.mapRemove2(xPos + 1, yPos + 1);
-                                }
-
-                                break;
-                            }
-                            default:
-                                continue;
-                        }
-                    }
-                }
+                addTileCargo(cargoSearchState, TilePos2(tx, ty));
             }
         }
 
@@ -489,7 +621,15 @@ namespace OpenLoco
     void setCatchmentDisplay(const Station* station, const CatchmentFlags catchmentFlag)
     {
         CargoSearchState cargoSearchState;
-        cargoSearchState.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
+        if (catchmentFlag == CatchmentFlags::flag_1)
+        {
+            // Only tiles in the catchment list can have this flag
+            cargoSearchState.resetCatchmentTiles();
+        }
+        else
+        {
+            cargoSearchState.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
+        }
 
         if (station == nullptr)
             return;
@@ -856,6 +996,10 @@ namespace OpenLoco
         maxPos.y++;
 
         cargoSearchState.setTileRegion(minPos.x, minPos.y, maxPos.x, maxPos.y, flag);
+        if (flag == CatchmentFlags::flag_1)
+        {
+            cargoSearchState.addCatchmentRegion(minPos.x, minPos.y, maxPos.x, maxPos.y);
+        }
     }
 
     // 0x00491BF5
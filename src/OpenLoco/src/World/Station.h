@@ -135,6 +135,10 @@ namespace OpenLoco
 #pragma pack(pop)
 
     void setCatchmentDisplay(const Station* station, const CatchmentFlags flags);
+    // The cargo search caches which industries and buildings are on each tile, these must be
+    // called whenever an industry, building or station element is added, removed or changed.
+    void invalidateTileCargo(const World::TilePos2& pos);
+    void invalidateAllTileCargo();
     struct PotentialCargo
     {
         uint32_t accepted;
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+#include <OpenLoco/Core/FileSystem.hpp>
+
+namespace OpenLoco::Platform
+{
+    // Maps a whole file into memory for reading. Pages are only loaded from disk when first
+    // accessed. The mapping is copy-on-write so writes are allowed but never reach the file.
+    class MemoryMappedFile
+    {
+    private:
+        std::byte* _data{};
+        size_t _size{};
+#ifdef _WIN32
+        void* _fileHandle{};
+        void* _mappingHandle{};
+#endif
+
+        void close();
+
+    public:
+        MemoryMappedFile() = default;
+        // Throws std::runtime_error if the file can not be mapped
+        explicit MemoryMappedFile(const fs::path& path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        std::byte* data() const { return _data; }
+        size_t size() const { return _size; }
+    };
+}
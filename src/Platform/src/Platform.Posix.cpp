@@ -1,11 +1,18 @@
 #ifndef _WIN32
 
+#include "MemoryMappedFile.h"
 #include "Platform.h"
 #include <cstdlib>
 #include <cstring>
+#include <fcntl.h>
 #include <iostream>
 #include <pwd.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
+#include <utility>
 
 #ifdef __linux__
 #include <linux/limits.h>
@@ -155,6 +162,68 @@ namespace OpenLoco::Platform
 
         return true;
     }
+
+    MemoryMappedFile::MemoryMappedFile(const fs::path& path)
+    {
+        const auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw std::runtime_error("Opening file for mapping failed.");
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Reading file size for mapping failed.");
+        }
+        _size = static_cast<size_t>(st.st_size);
+
+        if (_size != 0)
+        {
+            // The mapping keeps its own reference to the file so the descriptor can be closed straight away
+            auto* data = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("Mapping file failed.");
+            }
+            _data = static_cast<std::byte*>(data);
+        }
+        ::close(fd);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+        : _data(std::exchange(other._data, nullptr))
+        , _size(std::exchange(other._size, 0))
+    {
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (_data != nullptr)
+        {
+            munmap(_data, _size);
+        }
+        _data = nullptr;
+        _size = 0;
+    }
 }
 
 #endif
@@ -3,11 +3,14 @@
 #undef _CRT_SECURE_NO_WARNINGS
 #define _CRT_SECURE_NO_WARNINGS 1
 
+#include "MemoryMappedFile.h"
 #include "Platform.h"
 #include <cstdlib>
 #include <io.h>
 #include <iostream>
+#include <stdexcept>
 #include <tuple>
+#include <utility>
 
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -231,6 +234,86 @@ namespace OpenLoco::Platform
 
         return true;
     }
+
+    MemoryMappedFile::MemoryMappedFile(const fs::path& path)
+    {
+        auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Opening file for mapping failed.");
+        }
+        _fileHandle = file;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            close();
+            throw std::runtime_error("Reading file size for mapping failed.");
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+
+        if (_size != 0)
+        {
+            _mappingHandle = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            if (_mappingHandle == nullptr)
+            {
+                close();
+                throw std::runtime_error("Mapping file failed.");
+            }
+            _data = static_cast<std::byte*>(MapViewOfFile(_mappingHandle, FILE_MAP_COPY, 0, 0, 0));
+            if (_data == nullptr)
+            {
+                close();
+                throw std::runtime_error("Mapping file failed.");
+            }
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+        : _data(std::exchange(other._data, nullptr))
+        , _size(std::exchange(other._size, 0))
+        , _fileHandle(std::exchange(other._fileHandle, nullptr))
+        , _mappingHandle(std::exchange(other._mappingHandle, nullptr))
+    {
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+            _fileHandle = std::exchange(other._fileHandle, nullptr);
+            _mappingHandle = std::exchange(other._mappingHandle, nullptr);
+        }
+        return *this;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mappingHandle != nullptr)
+        {
+            CloseHandle(_mappingHandle);
+        }
+        if (_fileHandle != nullptr)
+        {
+            CloseHandle(_fileHandle);
+        }
+        _data = nullptr;
+        _size = 0;
+        _fileHandle = nullptr;
+        _mappingHandle = nullptr;
+    }
 }
 
 #endif